@@ -2,21 +2,39 @@
 # CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
 
 set(LIBRARY_EXPORT_HEADER "${GENERATED_FILES_DIRECTORY}/PtslCCppExport.h")
+set(REQUEST_BODIES_HEADER "${GENERATED_FILES_DIRECTORY}/CppPTSLRequestBodies.h")
+set(COMMAND_TRAITS_HEADER "${GENERATED_FILES_DIRECTORY}/CppPTSLCommandTraits.h")
 
 list(APPEND PUBLIC_HEADERS
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppAsync.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppCryptoUtils.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCancellationToken.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLClient.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCommon.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCommonConversions.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCoroutines.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonBuilder.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonField.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLRequest.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLResponse.h"
     "${LIBRARY_EXPORT_HEADER}"
+    "${REQUEST_BODIES_HEADER}"
+    "${COMMAND_TRAITS_HEADER}"
     )
 
 list(APPEND PRIVATE_HEADERS
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLAdmission.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLArenaPool.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLAsyncEngine.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLChannelPool.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLC_DefaultRequest.h"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLClientInternal.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLConnectionWatcher.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonCodec.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonScanner.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLResponseCache.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLRetry.h"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLTaskMonitor.h"
     )
 
 if (PTSLC_CPP_DEVMODE)
@@ -30,11 +48,24 @@ set(HEADERS ${PUBLIC_HEADERS} ${PRIVATE_HEADERS})
 list(APPEND SOURCES
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppAsync.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppCryptoUtils.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLAdmission.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLArenaPool.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLAsyncEngine.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCancellationToken.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLChannelPool.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLClient.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLC_DefaultRequest.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLCommonConversions.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLConnectionWatcher.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonBuilder.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonCodec.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonField.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLJsonScanner.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLRequest.cpp"
     "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLResponse.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLResponseCache.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLRetry.cpp"
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CppPTSLTaskMonitor.cpp"
     )
 
 list(APPEND COMMANDS_SOURCES
@@ -171,6 +202,13 @@ list(APPEND PROTO_FILES
         "${GRPC_SRC_DIR}/PTSL.2024.06.0.proto"
     )
 
+# The messages of this file get a generated JSON codec, see CppPTSLJsonCodec.h.
+set(JSON_CODEC_PROTO_FILE "${GRPC_SRC_DIR}/PTSL.proto")
+
+list(APPEND JSON_CODEC_GENERATOR_SOURCES
+    "${CMAKE_CURRENT_SOURCE_DIR}/Source/CodeGen/CppPTSLJsonCodecGenerator.cpp"
+    )
+
 set(PLIST_TEMPLATE_FILE "${CMAKE_CURRENT_SOURCE_DIR}/Resources/Info.plist.in")
 set(CMAKE_CONFIG_TEMPLATE_FILE "${CMAKE_CURRENT_SOURCE_DIR}/CMake/Config.cmake.in")
 
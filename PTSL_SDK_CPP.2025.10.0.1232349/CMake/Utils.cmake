@@ -69,6 +69,50 @@ function(generate_proto_files)
     set(${GEN_PROTO_OUTPUT_SOURCES_VARIABLE} "${SOURCES}" PARENT_SCOPE)
 endfunction()
 
+# Generate the JSON codec source of the messages of the .proto file, see Source/CppPTSLJsonCodec.h,
+# the OUTPUT_HEADER with the builders of its request bodies, see Source/CppPTSLJsonBuilder.h,
+# and the OUTPUT_TRAITS_HEADER with the body types of its commands, see CppPTSLClient::SendTyped.
+# GENERATOR is the executable target of PTSLJsonCodecGenerator, run on the descriptor set written by protoc.
+function(generate_json_codec_files)
+    cmake_parse_arguments(PARSE_ARGV 0 GEN_JSON "" "FILE;OUTPUT_DIRECTORY;OUTPUT_HEADER;OUTPUT_TRAITS_HEADER;PROTOC;GENERATOR;OUTPUT_SOURCES_VARIABLE" "")
+
+    if (NOT GEN_JSON_PROTOC)
+        find_program(GEN_JSON_PROTOC protoc NO_PACKAGE_ROOT_PATH NO_CMAKE_PATH NO_CMAKE_ENVIRONMENT_PATH)
+
+        if(NOT GEN_JSON_PROTOC)
+            message(FATAL_ERROR "Can't find protoc. Pass path to it as a function argument or update the PATH environment variable")
+        endif()
+    endif()
+
+    get_filename_component(PROTO_DIR "${GEN_JSON_FILE}" DIRECTORY)
+    get_filename_component(PROTO_NAME "${GEN_JSON_FILE}" NAME)
+    get_filename_component(PROTO_BASENAME "${GEN_JSON_FILE}" NAME_WLE)
+
+    set(DESCRIPTOR_SET "${GEN_JSON_OUTPUT_DIRECTORY}/${PROTO_BASENAME}.desc")
+    set(SOURCES "${GEN_JSON_OUTPUT_DIRECTORY}/${PROTO_BASENAME}.json.cc")
+
+    message(STATUS "Adding JSON codec generation for \"${GEN_JSON_FILE}\"")
+
+    add_custom_command(
+        OUTPUT ${SOURCES} "${GEN_JSON_OUTPUT_HEADER}" "${GEN_JSON_OUTPUT_TRAITS_HEADER}"
+        COMMAND "${CMAKE_COMMAND}" -E make_directory "${GEN_JSON_OUTPUT_DIRECTORY}"
+        COMMAND
+                "${GEN_JSON_PROTOC}"
+                "-I=${PROTO_DIR}"
+                "--include_imports"
+                "--include_source_info"
+                "--descriptor_set_out=${DESCRIPTOR_SET}"
+                "${GEN_JSON_FILE}"
+        COMMAND "${GEN_JSON_GENERATOR}" "${DESCRIPTOR_SET}" "${PROTO_NAME}" "${SOURCES}" "${GEN_JSON_OUTPUT_HEADER}"
+                "${GEN_JSON_OUTPUT_TRAITS_HEADER}"
+        DEPENDS "${GEN_JSON_FILE}" "${GEN_JSON_GENERATOR}"
+        COMMENT "Generating PTSL JSON codec, request body builders and command traits for the cpp"
+        VERBATIM
+    )
+
+    set(${GEN_JSON_OUTPUT_SOURCES_VARIABLE} "${SOURCES}" PARENT_SCOPE)
+endfunction()
+
 # Generate list of symbols which should not be exported in the result library.
 # This applies to static libraries which are not affected by current visibility setting.
 # TODO another solution:
@@ -0,0 +1,1287 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Build tool that generates the JSON codec of the messages of a .proto file, see CppPTSLJsonCodec.h,
+ * the builders of its request bodies, see CppPTSLJsonBuilder.h, and the body types of its commands,
+ * see CppPTSLClient::SendTyped.
+ *
+ * Usage: PTSLJsonCodecGenerator <descriptor set> <proto file name> <output .cc file> <output builders .h file>
+ *     <output command traits .h file>
+ *
+ * The descriptor set is written by protoc --include_imports --include_source_info --descriptor_set_out; the source
+ * info gives the builders the comments of the .proto file. The generated codec defines a reader and a writer for
+ * every message whose fields are all supported; the others, e.g. messages with maps, oneofs or bytes, are left
+ * to the reflective converter.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+
+namespace
+{
+    using google::protobuf::Descriptor;
+    using google::protobuf::EnumDescriptor;
+    using google::protobuf::FieldDescriptor;
+    using google::protobuf::FileDescriptor;
+
+    const std::set<std::string> CPP_KEYWORDS { "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+        "bool", "break", "case", "catch", "char", "char8_t", "char16_t", "char32_t", "class", "compl", "concept",
+        "const", "consteval", "constexpr", "constinit", "const_cast", "continue", "co_await", "co_return", "co_yield",
+        "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export",
+        "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace",
+        "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or", "or_eq", "private", "protected", "public",
+        "register", "reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static", "static_assert",
+        "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef",
+        "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor",
+        "xor_eq" };
+
+    /**
+     * C++ name of a message or enum type as generated by protoc, e.g. ptsl::Outer_Inner.
+     */
+    std::string CppTypeName(const std::string& fullName, const std::string& package)
+    {
+        std::string name = fullName.substr(package.empty() ? 0 : package.size() + 1);
+
+        for (char& c : name)
+        {
+            if (c == '.')
+            {
+                c = '_';
+            }
+        }
+
+        std::string cppPackage = package;
+
+        for (size_t position = cppPackage.find('.'); position != std::string::npos;
+            position = cppPackage.find('.', position))
+        {
+            cppPackage.replace(position, 1, "::");
+        }
+
+        return cppPackage.empty() ? "::" + name : "::" + cppPackage + "::" + name;
+    }
+
+    std::string CppTypeName(const Descriptor* descriptor)
+    {
+        return CppTypeName(descriptor->full_name(), descriptor->file()->package());
+    }
+
+    std::string CppTypeName(const EnumDescriptor* descriptor)
+    {
+        return CppTypeName(descriptor->full_name(), descriptor->file()->package());
+    }
+
+    /**
+     * Name of the accessors of a field as generated by protoc.
+     */
+    std::string CppFieldName(const FieldDescriptor* field)
+    {
+        std::string name = field->name();
+
+        for (char& c : name)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        return CPP_KEYWORDS.count(name) != 0 ? name + "_" : name;
+    }
+
+    /**
+     * C++ type the reader and the writer handle the scalar field as, or empty for enums and messages.
+     */
+    std::string CppScalarType(const FieldDescriptor* field)
+    {
+        switch (field->type())
+        {
+            case FieldDescriptor::TYPE_INT32:
+            case FieldDescriptor::TYPE_SINT32:
+            case FieldDescriptor::TYPE_SFIXED32:
+                return "int32_t";
+            case FieldDescriptor::TYPE_UINT32:
+            case FieldDescriptor::TYPE_FIXED32:
+                return "uint32_t";
+            case FieldDescriptor::TYPE_INT64:
+            case FieldDescriptor::TYPE_SINT64:
+            case FieldDescriptor::TYPE_SFIXED64:
+                return "int64_t";
+            case FieldDescriptor::TYPE_UINT64:
+            case FieldDescriptor::TYPE_FIXED64:
+                return "uint64_t";
+            case FieldDescriptor::TYPE_FLOAT:
+                return "float";
+            case FieldDescriptor::TYPE_DOUBLE:
+                return "double";
+            case FieldDescriptor::TYPE_BOOL:
+                return "bool";
+            case FieldDescriptor::TYPE_STRING:
+                return "std::string";
+            default:
+                return "";
+        }
+    }
+
+    class Generator
+    {
+    public:
+        explicit Generator(const FileDescriptor* file) : m_file(file)
+        {
+            for (int32_t i = 0; i < file->enum_type_count(); ++i)
+            {
+                m_enums.push_back(file->enum_type(i));
+            }
+
+            for (int32_t i = 0; i < file->message_type_count(); ++i)
+            {
+                CollectTypes(file->message_type(i));
+            }
+
+            FindSupportedMessages();
+            FindUsedEnums();
+        }
+
+        std::string Generate() const;
+
+        size_t GetSupportedCount() const
+        {
+            return m_supported.size();
+        }
+
+        size_t GetMessageCount() const
+        {
+            return m_messages.size();
+        }
+
+    private:
+        void CollectTypes(const Descriptor* message)
+        {
+            if (message->options().map_entry())
+            {
+                return;
+            }
+
+            m_messages.push_back(message);
+
+            for (int32_t i = 0; i < message->enum_type_count(); ++i)
+            {
+                m_enums.push_back(message->enum_type(i));
+            }
+
+            for (int32_t i = 0; i < message->nested_type_count(); ++i)
+            {
+                CollectTypes(message->nested_type(i));
+            }
+        }
+
+        bool HasSupportedFields(const Descriptor* message) const
+        {
+            if (message->extension_range_count() != 0)
+            {
+                return false;
+            }
+
+            for (int32_t i = 0; i < message->field_count(); ++i)
+            {
+                const FieldDescriptor* field = message->field(i);
+
+                // The writer only knows the presence of message fields, not of oneofs or optional scalars.
+                if (field->is_map() || field->containing_oneof() || field->type() == FieldDescriptor::TYPE_BYTES
+                    || field->type() == FieldDescriptor::TYPE_GROUP
+                    || (field->has_presence() && field->type() != FieldDescriptor::TYPE_MESSAGE))
+                {
+                    return false;
+                }
+
+                if (field->type() == FieldDescriptor::TYPE_ENUM && field->enum_type()->file() != m_file)
+                {
+                    return false;
+                }
+
+                if (field->type() == FieldDescriptor::TYPE_MESSAGE
+                    && (field->message_type()->file() != m_file || m_supported.count(field->message_type()) == 0))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Messages are supported if their fields are, including the fields of the messages they contain.
+         */
+        void FindSupportedMessages()
+        {
+            m_supported.insert(m_messages.begin(), m_messages.end());
+
+            for (bool isChanged = true; isChanged;)
+            {
+                isChanged = false;
+
+                for (const Descriptor* message : m_messages)
+                {
+                    if (m_supported.count(message) != 0 && !HasSupportedFields(message))
+                    {
+                        m_supported.erase(message);
+                        isChanged = true;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Enums are only generated for the fields of supported messages; an unused reader would be an unused function.
+         */
+        void FindUsedEnums()
+        {
+            for (const Descriptor* message : m_supported)
+            {
+                for (int32_t i = 0; i < message->field_count(); ++i)
+                {
+                    if (message->field(i)->type() == FieldDescriptor::TYPE_ENUM)
+                    {
+                        m_usedEnums.insert(message->field(i)->enum_type());
+                    }
+                }
+            }
+        }
+
+        void GenerateEnumReader(std::ostream& out, const EnumDescriptor* enumType) const;
+        void GenerateEnumWriter(std::ostream& out, const EnumDescriptor* enumType) const;
+        void GenerateMessageReader(std::ostream& out, const Descriptor* message) const;
+        void GenerateMessageWriter(std::ostream& out, const Descriptor* message) const;
+        void GenerateFieldReader(std::ostream& out, const FieldDescriptor* field) const;
+        void GenerateFieldWriter(std::ostream& out, const FieldDescriptor* field) const;
+
+        const FileDescriptor* m_file;
+        std::vector<const Descriptor*> m_messages;
+        std::vector<const EnumDescriptor*> m_enums;
+        std::set<const Descriptor*> m_supported;
+        std::set<const EnumDescriptor*> m_usedEnums;
+    };
+
+    std::string Generator::Generate() const
+    {
+        std::ostringstream out;
+        std::string headerName = m_file->name();
+        headerName = headerName.substr(0, headerName.rfind('.')) + ".pb.h";
+
+        out << "// Generated by PTSLJsonCodecGenerator from " << m_file->name() << ". Do not edit.\n"
+            << "\n"
+            << "#include \"CppPTSLJsonCodec.h\"\n"
+            << "\n"
+            << "#include <unordered_map>\n"
+            << "\n"
+            << "#include \"" << headerName << "\"\n"
+            << "\n"
+            << "namespace PTSLC_CPP\n"
+            << "{\n"
+            << "    namespace\n"
+            << "    {\n";
+
+        for (const EnumDescriptor* enumType : m_enums)
+        {
+            if (m_usedEnums.count(enumType) == 0)
+            {
+                continue;
+            }
+
+            out << "        bool Read(JsonReader& reader, " << CppTypeName(enumType) << "& value);\n"
+                << "        void Write(JsonWriter& writer, " << CppTypeName(enumType) << " value);\n";
+        }
+
+        for (const Descriptor* message : m_messages)
+        {
+            if (m_supported.count(message) != 0)
+            {
+                out << "        bool Read(JsonReader& reader, " << CppTypeName(message) << "& message);\n"
+                    << "        void Write(JsonWriter& writer, const " << CppTypeName(message) << "& message);\n";
+            }
+        }
+
+        for (const EnumDescriptor* enumType : m_enums)
+        {
+            if (m_usedEnums.count(enumType) == 0)
+            {
+                continue;
+            }
+
+            GenerateEnumReader(out, enumType);
+            GenerateEnumWriter(out, enumType);
+        }
+
+        for (const Descriptor* message : m_messages)
+        {
+            if (m_supported.count(message) != 0)
+            {
+                GenerateMessageReader(out, message);
+                GenerateMessageWriter(out, message);
+            }
+        }
+
+        out << "\n"
+            << "        template <typename Message>\n"
+            << "        bool ReadMessage(JsonReader& reader, google::protobuf::Message& message)\n"
+            << "        {\n"
+            << "            return Read(reader, static_cast<Message&>(message));\n"
+            << "        }\n"
+            << "\n"
+            << "        template <typename Message>\n"
+            << "        void WriteMessage(JsonWriter& writer, const google::protobuf::Message& message)\n"
+            << "        {\n"
+            << "            Write(writer, static_cast<const Message&>(message));\n"
+            << "        }\n"
+            << "    } // namespace\n"
+            << "\n"
+            << "    const GeneratedJsonCodec* FindGeneratedJsonCodec(const google::protobuf::Descriptor* descriptor)\n"
+            << "    {\n"
+            << "        static const std::unordered_map<const google::protobuf::Descriptor*, GeneratedJsonCodec> codecs {\n";
+
+        for (const Descriptor* message : m_messages)
+        {
+            if (m_supported.count(message) != 0)
+            {
+                const std::string type = CppTypeName(message);
+                out << "            { " << type << "::descriptor(), { &ReadMessage<" << type << ">, &WriteMessage<"
+                    << type << "> } },\n";
+            }
+        }
+
+        out << "        };\n"
+            << "\n"
+            << "        auto it = codecs.find(descriptor);\n"
+            << "        return it != codecs.end() ? &it->second : nullptr;\n"
+            << "    }\n"
+            << "} // namespace PTSLC_CPP\n";
+
+        return out.str();
+    }
+
+    void Generator::GenerateEnumReader(std::ostream& out, const EnumDescriptor* enumType) const
+    {
+        const std::string type = CppTypeName(enumType);
+        std::map<size_t, std::vector<const google::protobuf::EnumValueDescriptor*>> valuesByNameSize;
+
+        for (int32_t i = 0; i < enumType->value_count(); ++i)
+        {
+            valuesByNameSize[enumType->value(i)->name().size()].push_back(enumType->value(i));
+        }
+
+        out << "\n"
+            << "        bool Read(JsonReader& reader, " << type << "& value)\n"
+            << "        {\n"
+            << "            if (reader.IsString())\n"
+            << "            {\n"
+            << "                std::string_view name;\n"
+            << "\n"
+            << "                if (!reader.ReadEnumName(name))\n"
+            << "                {\n"
+            << "                    return false;\n"
+            << "                }\n"
+            << "\n"
+            << "                switch (name.size())\n"
+            << "                {\n";
+
+        for (const auto& [size, values] : valuesByNameSize)
+        {
+            out << "                    case " << size << ":\n";
+
+            for (const auto* value : values)
+            {
+                out << "                        if (name == \"" << value->name() << "\")\n"
+                    << "                        {\n"
+                    << "                            value = static_cast<" << type << ">(" << value->number() << ");\n"
+                    << "                            return true;\n"
+                    << "                        }\n";
+            }
+
+            out << "                        break;\n";
+        }
+
+        // Unknown names are ignored or rejected by the reflective parser, depending on the options.
+        out << "                }\n"
+            << "\n"
+            << "                return false;\n"
+            << "            }\n"
+            << "\n"
+            << "            int32_t number = 0;\n"
+            << "\n"
+            << "            if (!reader.Read(number))\n"
+            << "            {\n"
+            << "                return false;\n"
+            << "            }\n"
+            << "\n"
+            << "            value = static_cast<" << type << ">(number);\n"
+            << "            return true;\n"
+            << "        }\n";
+    }
+
+    void Generator::GenerateEnumWriter(std::ostream& out, const EnumDescriptor* enumType) const
+    {
+        out << "\n"
+            << "        void Write(JsonWriter& writer, " << CppTypeName(enumType) << " value)\n"
+            << "        {\n"
+            << "            switch (static_cast<int32_t>(value))\n"
+            << "            {\n";
+
+        std::set<int32_t> numbers;
+
+        // Aliases are written with the first name, like the reflective printer does.
+        for (int32_t i = 0; i < enumType->value_count(); ++i)
+        {
+            const auto* value = enumType->value(i);
+
+            if (numbers.insert(value->number()).second)
+            {
+                out << "                case " << value->number() << ":\n"
+                    << "                    writer.WriteEnumName(\"" << value->name() << "\");\n"
+                    << "                    return;\n";
+            }
+        }
+
+        out << "                default:\n"
+            << "                    writer.Write(static_cast<int32_t>(value));\n"
+            << "            }\n"
+            << "        }\n";
+    }
+
+    void Generator::GenerateMessageReader(std::ostream& out, const Descriptor* message) const
+    {
+        std::map<size_t, std::vector<std::pair<std::string, int32_t>>> keysBySize;
+
+        for (int32_t i = 0; i < message->field_count(); ++i)
+        {
+            const FieldDescriptor* field = message->field(i);
+            keysBySize[field->name().size()].emplace_back(field->name(), i);
+
+            if (field->json_name() != field->name())
+            {
+                keysBySize[field->json_name().size()].emplace_back(field->json_name(), i);
+            }
+        }
+
+        out << "\n"
+            << "        bool Read(JsonReader& reader, " << CppTypeName(message) << "& message)\n"
+            << "        {\n";
+
+        if (message->field_count() == 0)
+        {
+            out << "            (void)message;\n"
+                << "            return reader.ReadObject([&](std::string_view) { return reader.SkipUnknownValue(); });\n"
+                << "        }\n";
+            return;
+        }
+
+        out << "            JsonFieldSet<" << message->field_count() << "> fields;\n"
+            << "\n"
+            << "            return reader.ReadObject([&](std::string_view key) {\n"
+            << "                int32_t index = -1;\n"
+            << "\n"
+            << "                switch (key.size())\n"
+            << "                {\n";
+
+        for (const auto& [size, keys] : keysBySize)
+        {
+            out << "                    case " << size << ":\n";
+
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                out << "                        " << (i == 0 ? "if" : "else if") << " (key == \"" << keys[i].first
+                    << "\")\n"
+                    << "                        {\n"
+                    << "                            index = " << keys[i].second << ";\n"
+                    << "                        }\n";
+            }
+
+            out << "                        break;\n";
+        }
+
+        out << "                }\n"
+            << "\n"
+            << "                if (index < 0)\n"
+            << "                {\n"
+            << "                    return reader.SkipUnknownValue();\n"
+            << "                }\n"
+            << "\n"
+            << "                // The reflective parser lets the last of duplicate fields win, or merges them.\n"
+            << "                if (!fields.Insert(static_cast<size_t>(index)))\n"
+            << "                {\n"
+            << "                    return false;\n"
+            << "                }\n"
+            << "\n"
+            << "                switch (index)\n"
+            << "                {\n";
+
+        for (int32_t i = 0; i < message->field_count(); ++i)
+        {
+            out << "                    case " << i << ":\n";
+            GenerateFieldReader(out, message->field(i));
+        }
+
+        out << "                }\n"
+            << "\n"
+            << "                return false;\n"
+            << "            });\n"
+            << "        }\n";
+    }
+
+    void Generator::GenerateFieldReader(std::ostream& out, const FieldDescriptor* field) const
+    {
+        const std::string name = CppFieldName(field);
+        const std::string scalarType = CppScalarType(field);
+        const std::string indent = "                        ";
+
+        if (field->is_repeated())
+        {
+            out << indent << "return reader.ReadArray([&]() {\n";
+
+            if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+            {
+                out << indent << "    return Read(reader, *message.add_" << name << "());\n";
+            }
+            else if (field->type() == FieldDescriptor::TYPE_STRING)
+            {
+                out << indent << "    return reader.Read(*message.add_" << name << "());\n";
+            }
+            else
+            {
+                const std::string type = field->type() == FieldDescriptor::TYPE_ENUM
+                    ? CppTypeName(field->enum_type())
+                    : scalarType;
+                const std::string read = field->type() == FieldDescriptor::TYPE_ENUM ? "Read(reader, value)"
+                                                                                     : "reader.Read(value)";
+
+                out << indent << "    " << type << " value {};\n"
+                    << "\n"
+                    << indent << "    if (!" << read << ")\n"
+                    << indent << "    {\n"
+                    << indent << "        return false;\n"
+                    << indent << "    }\n"
+                    << "\n"
+                    << indent << "    message.add_" << name << "(value);\n"
+                    << indent << "    return true;\n";
+            }
+
+            out << indent << "});\n";
+            return;
+        }
+
+        if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+        {
+            out << indent << "return Read(reader, *message.mutable_" << name << "());\n";
+        }
+        else if (field->type() == FieldDescriptor::TYPE_STRING)
+        {
+            out << indent << "return reader.Read(*message.mutable_" << name << "());\n";
+        }
+        else
+        {
+            const std::string type = field->type() == FieldDescriptor::TYPE_ENUM ? CppTypeName(field->enum_type())
+                                                                                 : scalarType;
+            const std::string read = field->type() == FieldDescriptor::TYPE_ENUM ? "Read(reader, value)"
+                                                                                 : "reader.Read(value)";
+
+            out << indent << "{\n"
+                << indent << "    " << type << " value {};\n"
+                << "\n"
+                << indent << "    if (!" << read << ")\n"
+                << indent << "    {\n"
+                << indent << "        return false;\n"
+                << indent << "    }\n"
+                << "\n"
+                << indent << "    message.set_" << name << "(value);\n"
+                << indent << "    return true;\n"
+                << indent << "}\n";
+        }
+    }
+
+    void Generator::GenerateMessageWriter(std::ostream& out, const Descriptor* message) const
+    {
+        out << "\n"
+            << "        void Write(JsonWriter& writer, const " << CppTypeName(message) << "& message)\n"
+            << "        {\n";
+
+        if (message->field_count() == 0)
+        {
+            out << "            (void)message;\n";
+        }
+
+        out << "            writer.BeginObject();\n";
+
+        // The reflective printer writes the fields in the order of their numbers.
+        std::vector<const FieldDescriptor*> fields;
+
+        for (int32_t i = 0; i < message->field_count(); ++i)
+        {
+            fields.push_back(message->field(i));
+        }
+
+        std::stable_sort(fields.begin(), fields.end(), [](const FieldDescriptor* a, const FieldDescriptor* b) {
+            return a->number() < b->number();
+        });
+
+        for (const FieldDescriptor* field : fields)
+        {
+            GenerateFieldWriter(out, field);
+        }
+
+        out << "\n"
+            << "            writer.EndObject();\n"
+            << "        }\n";
+    }
+
+    void Generator::GenerateFieldWriter(std::ostream& out, const FieldDescriptor* field) const
+    {
+        const std::string name = CppFieldName(field);
+        std::string condition;
+
+        if (field->is_repeated())
+        {
+            condition = "writer.PrintsDefaults() || message." + name + "_size() != 0";
+        }
+        else if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+        {
+            condition = "message.has_" + name + "()";
+        }
+        else if (field->type() == FieldDescriptor::TYPE_ENUM)
+        {
+            condition = "writer.PrintsDefaults() || message." + name + "() != 0";
+        }
+        else if (field->type() == FieldDescriptor::TYPE_STRING)
+        {
+            condition = "writer.PrintsDefaults() || !message." + name + "().empty()";
+        }
+        else
+        {
+            condition = "writer.PrintsDefaults() || !JsonWriter::IsDefault(message." + name + "())";
+        }
+
+        out << "\n"
+            << "            if (" << condition << ")\n"
+            << "            {\n"
+            << "                writer.Key(\"" << field->name() << "\");\n";
+
+        const bool isGenerated =
+            field->type() == FieldDescriptor::TYPE_MESSAGE || field->type() == FieldDescriptor::TYPE_ENUM;
+
+        if (field->is_repeated())
+        {
+            std::string element = "const auto& element";
+            std::string value = "element";
+
+            if (field->type() == FieldDescriptor::TYPE_ENUM)
+            {
+                element = "int element";
+                value = "static_cast<" + CppTypeName(field->enum_type()) + ">(element)";
+            }
+
+            out << "                writer.BeginArray();\n"
+                << "\n"
+                << "                for (" << element << " : message." << name << "())\n"
+                << "                {\n"
+                << "                    writer.NextElement();\n"
+                << "                    " << (isGenerated ? "Write(writer, " : "writer.Write(") << value << ");\n"
+                << "                }\n"
+                << "\n"
+                << "                writer.EndArray();\n";
+        }
+        else
+        {
+            out << "                " << (isGenerated ? "Write(writer, " : "writer.Write(") << "message." << name
+                << "());\n";
+        }
+
+        out << "            }\n";
+    }
+
+    /**
+     * Name of the builder method of a field, e.g. TrackNames for track_names.
+     */
+    std::string CamelCaseName(const std::string& name)
+    {
+        std::string result;
+        bool isWordStart = true;
+
+        for (char c : name)
+        {
+            if (c == '_')
+            {
+                isWordStart = true;
+                continue;
+            }
+
+            result += isWordStart ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+            isWordStart = false;
+        }
+
+        return result;
+    }
+
+    /**
+     * Doc comment made of the comment of the element in the .proto file, or empty if there is none.
+     */
+    template <typename ElementDescriptor>
+    std::string DocComment(const ElementDescriptor* element, const std::string& indent)
+    {
+        google::protobuf::SourceLocation location;
+
+        if (!element->GetSourceLocation(&location))
+        {
+            return "";
+        }
+
+        std::istringstream text(
+            !location.leading_comments.empty() ? location.leading_comments : location.trailing_comments);
+        std::vector<std::string> lines;
+
+        for (std::string line; std::getline(text, line);)
+        {
+            const size_t start = line.find_first_not_of(" \t*");
+            const size_t end = line.find_last_not_of(" \t\r");
+            line = start == std::string::npos ? "" : line.substr(start, end - start + 1);
+
+            for (size_t position = line.find("*/"); position != std::string::npos; position = line.find("*/"))
+            {
+                line.replace(position, 2, "* /");
+            }
+
+            if (!line.empty() || (!lines.empty() && !lines.back().empty()))
+            {
+                lines.push_back(line);
+            }
+        }
+
+        while (!lines.empty() && lines.back().empty())
+        {
+            lines.pop_back();
+        }
+
+        if (lines.empty())
+        {
+            return "";
+        }
+
+        std::string comment = indent + "/**\n";
+
+        for (const std::string& line : lines)
+        {
+            comment += indent + (line.empty() ? " *\n" : " * " + line + "\n");
+        }
+
+        return comment + indent + " */\n";
+    }
+
+    /**
+     * Generates the public header with a builder for each *RequestBody message and the messages and enums
+     * their fields use, see CppPTSLJsonBuilder.h. Maps and bytes fields are left out.
+     */
+    class RequestBodyGenerator
+    {
+    public:
+        explicit RequestBodyGenerator(const FileDescriptor* file)
+        {
+            for (int32_t i = 0; i < file->message_type_count(); ++i)
+            {
+                const Descriptor* message = file->message_type(i);
+                const std::string& name = message->name();
+
+                if (name.size() > BODY_SUFFIX.size()
+                    && name.compare(name.size() - BODY_SUFFIX.size(), BODY_SUFFIX.size(), BODY_SUFFIX) == 0)
+                {
+                    m_classNames[message] = name.substr(0, name.size() - BODY_SUFFIX.size()) + "Body";
+                    CollectTypes(message);
+                    ++m_bodyCount;
+                }
+            }
+
+            for (const Descriptor* message : m_messages)
+            {
+                m_classNames.emplace(message, CppTypeName(message).substr(CppTypeName(message).rfind(':') + 1));
+            }
+        }
+
+        /**
+         * Returns false if two of the generated types would have the same name.
+         */
+        bool HasUniqueNames(std::string& duplicate) const
+        {
+            std::set<std::string> names;
+
+            for (const auto& [message, name] : m_classNames)
+            {
+                if (!names.insert(name).second)
+                {
+                    duplicate = name;
+                    return false;
+                }
+            }
+
+            for (const EnumDescriptor* enumType : m_enums)
+            {
+                if (!names.insert(EnumName(enumType)).second)
+                {
+                    duplicate = EnumName(enumType);
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::string Generate() const;
+
+        size_t GetBodyCount() const
+        {
+            return m_bodyCount;
+        }
+
+    private:
+        static bool IsWritten(const FieldDescriptor* field)
+        {
+            return !field->is_map() && field->type() != FieldDescriptor::TYPE_BYTES
+                && field->type() != FieldDescriptor::TYPE_GROUP;
+        }
+
+        static std::string EnumName(const EnumDescriptor* enumType)
+        {
+            const std::string name = CppTypeName(enumType);
+            return name.substr(name.rfind(':') + 1);
+        }
+
+        /**
+         * Collects the types the fields of the message use, the used messages before the ones using them.
+         */
+        void CollectTypes(const Descriptor* message)
+        {
+            if (!m_visited.insert(message).second)
+            {
+                return;
+            }
+
+            for (int32_t i = 0; i < message->field_count(); ++i)
+            {
+                const FieldDescriptor* field = message->field(i);
+
+                if (!IsWritten(field))
+                {
+                    continue;
+                }
+
+                if (field->type() == FieldDescriptor::TYPE_ENUM
+                    && std::find(m_enums.begin(), m_enums.end(), field->enum_type()) == m_enums.end())
+                {
+                    m_enums.push_back(field->enum_type());
+                }
+
+                if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+                {
+                    CollectTypes(field->message_type());
+                }
+            }
+
+            m_messages.push_back(message);
+        }
+
+        void GenerateEnum(std::ostream& out, const EnumDescriptor* enumType) const;
+        void GenerateBuilder(std::ostream& out, const Descriptor* message) const;
+        void GenerateSetter(std::ostream& out, const std::string& className, const FieldDescriptor* field) const;
+
+        static const std::string BODY_SUFFIX;
+
+        std::set<const Descriptor*> m_visited;
+        std::vector<const Descriptor*> m_messages;
+        std::vector<const EnumDescriptor*> m_enums;
+        std::map<const Descriptor*, std::string> m_classNames;
+        size_t m_bodyCount = 0;
+    };
+
+    const std::string RequestBodyGenerator::BODY_SUFFIX = "RequestBody";
+
+    std::string RequestBodyGenerator::Generate() const
+    {
+        std::ostringstream out;
+        const FileDescriptor* file = m_messages.empty() ? nullptr : m_messages.front()->file();
+
+        out << "// Generated by PTSLJsonCodecGenerator from " << (file ? file->name() : "") << ". Do not edit.\n"
+            << "\n"
+            << "/**\n"
+            << " * @file\n"
+            << " * @brief Builders of the request body JSON of the commands, for CppPTSLRequest.\n"
+            << " *\n"
+            << " * E.g. RequestBodies::SetTrackMuteStateBody{}.TrackNames(names).Enabled(true).GetJson().\n"
+            << " *\n"
+            << " * Each *RequestBody message of the .proto file has a builder named without \"Request\",\n"
+            << " * the messages and enums used by their fields have builders and enums of the same name.\n"
+            << " * Fields of message type are set by a function that fills their builder, e.g.\n"
+            << " * GetTrackListBody{}.PaginationRequest([](auto& pagination) { pagination.Limit(100); }).\n"
+            << " */\n"
+            << "\n"
+            << "#pragma once\n"
+            << "\n"
+            << "#include <cstdint>\n"
+            << "#include <initializer_list>\n"
+            << "#include <string>\n"
+            << "#include <string_view>\n"
+            << "#include <utility>\n"
+            << "\n"
+            << "#include \"CppPTSLJsonBuilder.h\"\n"
+            << "\n"
+            << "namespace PTSLC_CPP\n"
+            << "{\n"
+            << "    namespace RequestBodies\n"
+            << "    {\n";
+
+        for (const EnumDescriptor* enumType : m_enums)
+        {
+            GenerateEnum(out, enumType);
+        }
+
+        for (const Descriptor* message : m_messages)
+        {
+            GenerateBuilder(out, message);
+        }
+
+        out << "    } // namespace RequestBodies\n"
+            << "} // namespace PTSLC_CPP\n";
+
+        return out.str();
+    }
+
+    void RequestBodyGenerator::GenerateEnum(std::ostream& out, const EnumDescriptor* enumType) const
+    {
+        const std::string name = EnumName(enumType);
+
+        out << DocComment(enumType, "        ") << "        enum class " << name << " : int32_t\n"
+            << "        {\n";
+
+        for (int32_t i = 0; i < enumType->value_count(); ++i)
+        {
+            const auto* value = enumType->value(i);
+            out << DocComment(value, "            ") << "            " << value->name() << " = " << value->number()
+                << ",\n";
+        }
+
+        out << "        };\n"
+            << "\n"
+            << "        inline void AppendJsonValue(std::string& json, " << name << " value)\n"
+            << "        {\n"
+            << "            switch (value)\n"
+            << "            {\n";
+
+        std::set<int32_t> numbers;
+
+        // Aliases are written with the first name, like protobuf does.
+        for (int32_t i = 0; i < enumType->value_count(); ++i)
+        {
+            const auto* value = enumType->value(i);
+
+            if (numbers.insert(value->number()).second)
+            {
+                out << "                case " << name << "::" << value->name() << ":\n"
+                    << "                    json += \"\\\"" << value->name() << "\\\"\";\n"
+                    << "                    return;\n";
+            }
+        }
+
+        out << "            }\n"
+            << "\n"
+            << "            PTSLC_CPP::AppendJsonValue(json, static_cast<int32_t>(value));\n"
+            << "        }\n"
+            << "\n";
+    }
+
+    void RequestBodyGenerator::GenerateBuilder(std::ostream& out, const Descriptor* message) const
+    {
+        const std::string& name = m_classNames.at(message);
+
+        out << DocComment(message, "        ") << "        class " << name << " : public CppPTSLJsonBuilder\n"
+            << "        {\n"
+            << "        public:\n"
+            << "            " << name << "() = default;\n"
+            << "\n"
+            << "            explicit " << name << "(std::string& json) : CppPTSLJsonBuilder(json)\n"
+            << "            {\n"
+            << "            }\n";
+
+        for (int32_t i = 0; i < message->field_count(); ++i)
+        {
+            if (IsWritten(message->field(i)))
+            {
+                GenerateSetter(out, name, message->field(i));
+            }
+        }
+
+        out << "        };\n"
+            << "\n";
+    }
+
+    void RequestBodyGenerator::GenerateSetter(
+        std::ostream& out, const std::string& className, const FieldDescriptor* field) const
+    {
+        std::string setter = CamelCaseName(field->name());
+        const std::string indent = "            ";
+        const std::string comment = DocComment(field, indent);
+
+        // a member can't have the name of its class or hide the members of the base class
+        if (setter == className || setter == "GetJson")
+        {
+            setter = "Set" + setter;
+        }
+
+        const std::string key = "\"" + field->name() + "\"";
+
+        if (field->type() == FieldDescriptor::TYPE_MESSAGE)
+        {
+            const std::string builder = "RequestBodies::" + m_classNames.at(field->message_type());
+
+            if (field->is_repeated())
+            {
+                out << "\n"
+                    << comment << indent << "template <typename TRange, typename TFill>\n"
+                    << indent << className << "& " << setter << "(const TRange& items, TFill&& fill)\n"
+                    << indent << "{\n"
+                    << indent << "    WriteObjectArray<" << builder << ">(" << key << ", items, fill);\n";
+            }
+            else
+            {
+                out << "\n"
+                    << comment << indent << "template <typename TFill>\n"
+                    << indent << className << "& " << setter << "(TFill&& fill)\n"
+                    << indent << "{\n"
+                    << indent << "    WriteObject<" << builder << ">(" << key << ", std::forward<TFill>(fill));\n";
+            }
+
+            out << indent << "    return *this;\n"
+                << indent << "}\n";
+            return;
+        }
+
+        // qualified, as a setter may have the name of the enum
+        std::string type = field->type() == FieldDescriptor::TYPE_ENUM
+            ? "RequestBodies::" + EnumName(field->enum_type())
+            : CppScalarType(field);
+
+        if (field->type() == FieldDescriptor::TYPE_STRING)
+        {
+            type = "std::string_view";
+        }
+
+        if (!field->is_repeated())
+        {
+            out << "\n"
+                << comment << indent << className << "& " << setter << "(" << type << " value)\n"
+                << indent << "{\n"
+                << indent << "    WriteField(" << key << ", value);\n"
+                << indent << "    return *this;\n"
+                << indent << "}\n";
+            return;
+        }
+
+        out << "\n"
+            << comment << indent << "template <typename TRange>\n"
+            << indent << className << "& " << setter << "(const TRange& values)\n"
+            << indent << "{\n"
+            << indent << "    WriteArray<" << type << ">(" << key << ", values);\n"
+            << indent << "    return *this;\n"
+            << indent << "}\n"
+            << "\n"
+            << indent << className << "& " << setter << "(std::initializer_list<" << type << "> values)\n"
+            << indent << "{\n"
+            << indent << "    WriteArray<" << type << ">(" << key << ", values);\n"
+            << indent << "    return *this;\n"
+            << indent << "}\n";
+    }
+
+    /**
+     * Generates the public header with the CommandTraits of each command, see CppPTSLClient::SendTyped.
+     * The command CId_X has the bodies XRequestBody and XResponseBody, if the file defines them;
+     * CppPTSLClient.cpp finds the bodies by the same rule.
+     */
+    class CommandTraitsGenerator
+    {
+    public:
+        explicit CommandTraitsGenerator(const FileDescriptor* file) : m_file(file)
+        {
+            const EnumDescriptor* commandIds = file->FindEnumTypeByName("CommandId");
+            std::set<int32_t> numbers;
+
+            for (int32_t i = 0; commandIds && i < commandIds->value_count(); ++i)
+            {
+                const std::string& name = commandIds->value(i)->name();
+
+                // the other names of a number are deprecated aliases
+                if (name.compare(0, COMMAND_PREFIX.size(), COMMAND_PREFIX) == 0
+                    && numbers.insert(commandIds->value(i)->number()).second)
+                {
+                    m_commands.push_back(commandIds->value(i));
+                }
+            }
+        }
+
+        std::string Generate() const;
+
+        size_t GetCommandCount() const
+        {
+            return m_commands.size();
+        }
+
+    private:
+        std::string BodyType(const std::string& commandName, const std::string& suffix) const
+        {
+            const Descriptor* body = m_file->FindMessageTypeByName(commandName.substr(COMMAND_PREFIX.size()) + suffix);
+            return body ? CppTypeName(body) : "google::protobuf::Empty";
+        }
+
+        static const std::string COMMAND_PREFIX;
+
+        const FileDescriptor* m_file;
+        std::vector<const google::protobuf::EnumValueDescriptor*> m_commands;
+    };
+
+    const std::string CommandTraitsGenerator::COMMAND_PREFIX = "CId_";
+
+    std::string CommandTraitsGenerator::Generate() const
+    {
+        const std::string& fileName = m_file->name();
+        const std::string pbHeader = fileName.substr(0, fileName.rfind('.')) + ".pb.h";
+        std::ostringstream out;
+
+        out << "// Generated by PTSLJsonCodecGenerator from " << fileName << ". Do not edit.\n"
+            << "\n"
+            << "/**\n"
+            << " * @file\n"
+            << " * @brief Request and response body types of the commands, for CppPTSLClient::SendTyped.\n"
+            << " *\n"
+            << " * E.g. CommandTraits<CommandId::CId_GetClipList>::Response is ptsl::GetClipListResponseBody.\n"
+            << " * The command CId_X has the bodies XRequestBody and XResponseBody of the .proto file;\n"
+            << " * a body the command doesn't have is google::protobuf::Empty.\n"
+            << " *\n"
+            << " * Needs the " << pbHeader << " generated by protoc from the " << fileName << " of the SDK.\n"
+            << " */\n"
+            << "\n"
+            << "#pragma once\n"
+            << "\n"
+            << "#include <google/protobuf/empty.pb.h>\n"
+            << "\n"
+            << "#include \"CppPTSLClient.h\"\n"
+            << "#include \"" << pbHeader << "\"\n"
+            << "\n"
+            << "namespace PTSLC_CPP\n"
+            << "{\n";
+
+        for (size_t i = 0; i < m_commands.size(); ++i)
+        {
+            const std::string& name = m_commands[i]->name();
+
+            // by number, since the names of the public CommandId don't always match the ones of the .proto file
+            out << (i == 0 ? "" : "\n") << "    template <>\n"
+                << "    struct CommandTraits<static_cast<CommandId>(" << m_commands[i]->number() << ")>\n"
+                << "    {\n"
+                << "        using Request = " << BodyType(name, "RequestBody") << ";\n"
+                << "        using Response = " << BodyType(name, "ResponseBody") << ";\n"
+                << "        static constexpr const char* NAME = \"" << name << "\";\n"
+                << "    };\n";
+        }
+
+        out << "} // namespace PTSLC_CPP\n";
+
+        return out.str();
+    }
+
+    bool ReadFile(const std::string& path, std::string& content)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        std::ostringstream stream;
+        stream << file.rdbuf();
+        content = stream.str();
+        return true;
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 6)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " <descriptor set> <proto file name> <output .cc file> <output builders .h file>"
+                     " <output command traits .h file>\n";
+        return 1;
+    }
+
+    std::string content;
+    google::protobuf::FileDescriptorSet descriptorSet;
+
+    if (!ReadFile(argv[1], content) || !descriptorSet.ParseFromString(content))
+    {
+        std::cerr << "Can't read the descriptor set " << argv[1] << "\n";
+        return 1;
+    }
+
+    google::protobuf::DescriptorPool pool;
+
+    for (const auto& fileProto : descriptorSet.file())
+    {
+        if (!pool.BuildFile(fileProto))
+        {
+            std::cerr << "Can't build the descriptor of " << fileProto.name() << "\n";
+            return 1;
+        }
+    }
+
+    const FileDescriptor* file = pool.FindFileByName(argv[2]);
+
+    if (!file)
+    {
+        std::cerr << "The descriptor set has no file " << argv[2] << "\n";
+        return 1;
+    }
+
+    Generator generator(file);
+    RequestBodyGenerator bodyGenerator(file);
+    CommandTraitsGenerator traitsGenerator(file);
+    std::string duplicate;
+
+    if (!bodyGenerator.HasUniqueNames(duplicate))
+    {
+        std::cerr << "More than one request body builder type would be named " << duplicate << "\n";
+        return 1;
+    }
+
+    const std::pair<const char*, std::string> outputs[] = { { argv[3], generator.Generate() },
+        { argv[4], bodyGenerator.Generate() }, { argv[5], traitsGenerator.Generate() } };
+
+    for (const auto& [path, generated] : outputs)
+    {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        output << generated;
+
+        if (!output.good())
+        {
+            std::cerr << "Can't write " << path << "\n";
+            return 1;
+        }
+    }
+
+    std::cout << "Generated the JSON codec of " << generator.GetSupportedCount() << " of "
+              << generator.GetMessageCount() << " messages and the builders of " << bodyGenerator.GetBodyCount()
+              << " request bodies and the traits of " << traitsGenerator.GetCommandCount() << " commands of "
+              << argv[2] << "\n";
+    return 0;
+}
@@ -23,43 +23,38 @@ namespace PTSLC_CPP
                 return "AsyncGetMemoryLocations";
             }
 
-            void OnHasBody() override
+            void OnListElement(const google::protobuf::Message& element) override
             {
-                std::vector<MemoryLocation> memoryLocationsTempList;
-                for (const auto& item : mGrpcResponseBody.memory_locations())
-                {
-                    MemoryLocation memoryLocation;
-
-                    memoryLocation.number = item.number();
-                    memoryLocation.name = item.name();
-                    memoryLocation.startTime = item.start_time();
-                    memoryLocation.endTime = item.end_time();
-                    memoryLocation.timeProperties = static_cast<TimeProperties>(item.time_properties());
-                    memoryLocation.reference = static_cast<MemoryLocationReference>(item.reference());
-                    memoryLocation.comments = item.comments();
-                    memoryLocation.location = static_cast<MarkerLocation>(item.location());
-                    memoryLocation.trackName = item.track_name();
-                    memoryLocation.colorIndex = item.color_index();
-
-                    MemoryLocationProperties generalProperties;
-                    generalProperties.zoomSettings = item.general_properties().zoom_settings();
-                    generalProperties.prePostRollTimes = item.general_properties().pre_post_roll_times();
-                    generalProperties.trackVisibility = item.general_properties().track_visibility();
-                    generalProperties.trackHeights = item.general_properties().track_heights();
-                    generalProperties.groupEnables = item.general_properties().group_enables();
-                    generalProperties.windowConfiguration = item.general_properties().window_configuration();
-                    generalProperties.windowConfigurationIndex = item.general_properties().window_configuration_index();
-                    generalProperties.windowConfigurationName = item.general_properties().window_configuration_name();
-                    generalProperties.venueSnapshotIndex = item.general_properties().venue_snapshot_index();
-                    generalProperties.venueSnapshotName = item.general_properties().venue_snapshot_name();
-                    memoryLocation.generalProperties = generalProperties;
-
-                    memoryLocationsTempList.push_back(memoryLocation);
-                }
-
-                std::dynamic_pointer_cast<GetMemoryLocationsResponse>(mResponse)->memoryLocations = {
-                    memoryLocationsTempList.begin(), memoryLocationsTempList.end()
-                };
+                const auto& item = static_cast<const ptsl::MemoryLocation&>(element);
+
+                MemoryLocation memoryLocation;
+
+                memoryLocation.number = item.number();
+                memoryLocation.name = item.name();
+                memoryLocation.startTime = item.start_time();
+                memoryLocation.endTime = item.end_time();
+                memoryLocation.timeProperties = static_cast<TimeProperties>(item.time_properties());
+                memoryLocation.reference = static_cast<MemoryLocationReference>(item.reference());
+                memoryLocation.comments = item.comments();
+                memoryLocation.location = static_cast<MarkerLocation>(item.location());
+                memoryLocation.trackName = item.track_name();
+                memoryLocation.colorIndex = item.color_index();
+
+                MemoryLocationProperties generalProperties;
+                generalProperties.zoomSettings = item.general_properties().zoom_settings();
+                generalProperties.prePostRollTimes = item.general_properties().pre_post_roll_times();
+                generalProperties.trackVisibility = item.general_properties().track_visibility();
+                generalProperties.trackHeights = item.general_properties().track_heights();
+                generalProperties.groupEnables = item.general_properties().group_enables();
+                generalProperties.windowConfiguration = item.general_properties().window_configuration();
+                generalProperties.windowConfigurationIndex = item.general_properties().window_configuration_index();
+                generalProperties.windowConfigurationName = item.general_properties().window_configuration_name();
+                generalProperties.venueSnapshotIndex = item.general_properties().venue_snapshot_index();
+                generalProperties.venueSnapshotName = item.general_properties().venue_snapshot_name();
+                memoryLocation.generalProperties = generalProperties;
+
+                std::dynamic_pointer_cast<GetMemoryLocationsResponse>(mResponse)->memoryLocations.push_back(
+                    memoryLocation);
             }
 
             void OnNoBody() override
@@ -80,6 +75,11 @@ namespace PTSLC_CPP
                 return mGrpcResponseBody;
             }
 
+            const google::protobuf::FieldDescriptor* GetStreamedListField() const override
+            {
+                return ptsl::GetMemoryLocationsResponseBody::descriptor()->FindFieldByName("memory_locations");
+            }
+
         private:
             void FillGrpcRequest(const GetMemoryLocationsRequest& request)
             {
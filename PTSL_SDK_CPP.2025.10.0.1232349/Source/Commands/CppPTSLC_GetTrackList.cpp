@@ -22,51 +22,12 @@ namespace PTSLC_CPP
                 return "AsyncGetTrackList";
             }
 
-            void OnHasBody() override
+            void OnListElement(const google::protobuf::Message& element) override
             {
-                auto FillTrack = [](const ptsl::Track& iSrcTrack, Track& oDstTrack)
-                {
-                    TrackAttributes attributes;
-                    attributes.isInactive =
-                        static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_inactive());
-                    attributes.isHidden = static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_hidden());
-                    attributes.isSelected =
-                        static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_selected());
-                    attributes.containsClips = iSrcTrack.track_attributes().contains_clips();
-                    attributes.containsAutomation = iSrcTrack.track_attributes().contains_automation();
-                    attributes.isSoloed = iSrcTrack.track_attributes().is_soloed();
-                    attributes.isRecordEnabled = iSrcTrack.track_attributes().is_record_enabled();
-                    attributes.isInputMonitoringOn =
-                        static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_input_monitoring_on());
-                    attributes.isSmartDspOn = iSrcTrack.track_attributes().is_smart_dsp_on();
-                    attributes.isLocked = iSrcTrack.track_attributes().is_locked();
-                    attributes.isMuted = iSrcTrack.track_attributes().is_muted();
-                    attributes.isFrozen = iSrcTrack.track_attributes().is_frozen();
-                    attributes.isOpen = iSrcTrack.track_attributes().is_open();
-                    attributes.isOnline = iSrcTrack.track_attributes().is_online();
-                    attributes.isRecordEnabledSafe = iSrcTrack.track_attributes().is_record_enabled_safe();
-                    attributes.isSmartDspOnSafe = iSrcTrack.track_attributes().is_smart_dsp_on_safe();
-                    attributes.isSoloedSafe = iSrcTrack.track_attributes().is_soloed_safe();
-                    oDstTrack.name = iSrcTrack.name();
-                    oDstTrack.type = static_cast<TrackType>(iSrcTrack.type());
-                    oDstTrack.id = iSrcTrack.id();
-                    oDstTrack.index = iSrcTrack.index();
-                    oDstTrack.color = iSrcTrack.color();
-                    oDstTrack.idCompressed = iSrcTrack.id_compressed();
-                    oDstTrack.format = static_cast<TrackFormat>(iSrcTrack.format());
-                    oDstTrack.timebase = static_cast<TrackTimebase>(iSrcTrack.timebase());
-                    oDstTrack.trackAttributes = attributes;
-                    oDstTrack.parentFolderName = iSrcTrack.parent_folder_name();
-                    oDstTrack.parentFolderId = iSrcTrack.parent_folder_id();
-                };
-
-                for (const auto& item : mGrpcResponseBody.track_list())
-                {
-                    Track track;
-                    FillTrack(item, track);
+                Track track;
+                FillTrack(static_cast<const ptsl::Track&>(element), track);
 
-                    std::dynamic_pointer_cast<GetTrackListResponse>(mResponse)->trackList.push_back(track);
-                }
+                std::dynamic_pointer_cast<GetTrackListResponse>(mResponse)->trackList.push_back(track);
             }
 
             void OnNoBody() override
@@ -87,7 +48,46 @@ namespace PTSLC_CPP
                 return mGrpcResponseBody;
             }
 
+            const google::protobuf::FieldDescriptor* GetStreamedListField() const override
+            {
+                return ptsl::GetTrackListResponseBody::descriptor()->FindFieldByName("track_list");
+            }
+
         private:
+            static void FillTrack(const ptsl::Track& iSrcTrack, Track& oDstTrack)
+            {
+                TrackAttributes attributes;
+                attributes.isInactive = static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_inactive());
+                attributes.isHidden = static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_hidden());
+                attributes.isSelected = static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_selected());
+                attributes.containsClips = iSrcTrack.track_attributes().contains_clips();
+                attributes.containsAutomation = iSrcTrack.track_attributes().contains_automation();
+                attributes.isSoloed = iSrcTrack.track_attributes().is_soloed();
+                attributes.isRecordEnabled = iSrcTrack.track_attributes().is_record_enabled();
+                attributes.isInputMonitoringOn =
+                    static_cast<TrackAttributeState>(iSrcTrack.track_attributes().is_input_monitoring_on());
+                attributes.isSmartDspOn = iSrcTrack.track_attributes().is_smart_dsp_on();
+                attributes.isLocked = iSrcTrack.track_attributes().is_locked();
+                attributes.isMuted = iSrcTrack.track_attributes().is_muted();
+                attributes.isFrozen = iSrcTrack.track_attributes().is_frozen();
+                attributes.isOpen = iSrcTrack.track_attributes().is_open();
+                attributes.isOnline = iSrcTrack.track_attributes().is_online();
+                attributes.isRecordEnabledSafe = iSrcTrack.track_attributes().is_record_enabled_safe();
+                attributes.isSmartDspOnSafe = iSrcTrack.track_attributes().is_smart_dsp_on_safe();
+                attributes.isSoloedSafe = iSrcTrack.track_attributes().is_soloed_safe();
+                oDstTrack.name = iSrcTrack.name();
+                oDstTrack.type = static_cast<TrackType>(iSrcTrack.type());
+                oDstTrack.id = iSrcTrack.id();
+                oDstTrack.index = iSrcTrack.index();
+                oDstTrack.color = iSrcTrack.color();
+                oDstTrack.idCompressed = iSrcTrack.id_compressed();
+                oDstTrack.format = static_cast<TrackFormat>(iSrcTrack.format());
+                oDstTrack.timebase = static_cast<TrackTimebase>(iSrcTrack.timebase());
+                oDstTrack.trackAttributes = attributes;
+                oDstTrack.parentFolderName = iSrcTrack.parent_folder_name();
+                oDstTrack.parentFolderId = iSrcTrack.parent_folder_id();
+            }
+
             void FillGrpcRequest(const GetTrackListRequest& request)
             {
                 mGrpcRequestBody.mutable_pagination_request()->set_limit(request.paginationRequest.limit);
@@ -28,12 +28,7 @@ namespace PTSLC_CPP
             RegisterConnectionHandler(CppPTSLClient* client, const RegisterConnectionRequest& request)
                 : mClient(client)
             {
-                std::string jsonBody = request.directJsonBody;
-                if (!jsonBody.empty() && !std::all_of(jsonBody.begin(), jsonBody.end(), isspace))
-                {
-                    google::protobuf::util::JsonStringToMessage(jsonBody, &mGrpcRequestBody);
-                }
-                else
+                if (!this->SetDirectJsonBody(request.directJsonBody))
                 {
                     this->FillGrpcRequest(request);
                 }
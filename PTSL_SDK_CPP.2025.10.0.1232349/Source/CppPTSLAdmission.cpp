@@ -0,0 +1,301 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLAdmission.h
+ */
+
+#include "CppPTSLAdmission.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        /// Latency above the baseline multiplied by this factor counts as queueing on the server.
+        constexpr double LATENCY_TOLERANCE = 2.0;
+
+        /// Bounds of the multiplicative decrease of the adaptive limit; within them it's proportional to the queueing.
+        constexpr double MIN_LIMIT_BACKOFF = 0.5;
+        constexpr double MAX_LIMIT_BACKOFF = 0.9;
+
+        /// Lets the baseline follow a server that became slower for good instead of shrinking the limit forever.
+        constexpr double BASELINE_DRIFT = 0.001;
+
+        size_t ClassIndex(CommandClass commandClass)
+        {
+            return static_cast<size_t>(commandClass);
+        }
+    } // namespace
+
+    AdmissionController::AdmissionController(int32_t maxInFlight,
+        const std::map<CommandClass, int32_t>& classLimits,
+        bool isAdaptive,
+        std::chrono::milliseconds agingInterval)
+        : m_maxInFlight(std::max(maxInFlight, 0)),
+          m_isAdaptive(isAdaptive && maxInFlight > 0),
+          m_agingInterval(std::max(agingInterval, std::chrono::milliseconds { 1 })),
+          m_limit(static_cast<double>(m_maxInFlight))
+    {
+        for (const auto& classLimit : classLimits)
+        {
+            if (ClassIndex(classLimit.first) < CLASS_COUNT && classLimit.second > 0)
+            {
+                m_classLimits[ClassIndex(classLimit.first)] = classLimit.second;
+            }
+        }
+    }
+
+    bool AdmissionController::TryAcquire(CommandClass commandClass)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Waiters of the same class go first; the ones of other classes are blocked by their own limit.
+        if (m_classWaiting[ClassIndex(commandClass)] > 0 || !HasCapacity(commandClass))
+        {
+            return false;
+        }
+
+        Acquire(commandClass);
+        return true;
+    }
+
+    std::shared_ptr<AdmissionController::Waiter> AdmissionController::CreateWaiter(
+        CommandClass commandClass, RequestPriority priority, std::function<void()> onAdmitted)
+    {
+        auto waiter = std::make_shared<Waiter>();
+        waiter->m_commandClass = commandClass;
+        waiter->m_priority = priority;
+        waiter->m_onAdmitted = std::move(onAdmitted);
+        return waiter;
+    }
+
+    void AdmissionController::Enqueue(const std::shared_ptr<Waiter>& waiter)
+    {
+        std::vector<std::function<void()>> admitted;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (waiter->m_state != Waiter::State::Created)
+            {
+                return;
+            }
+
+            waiter->m_state = Waiter::State::Queued;
+            waiter->m_enqueuedAt = std::chrono::steady_clock::now();
+            m_waiters.push_back(waiter);
+            ++m_classWaiting[ClassIndex(waiter->m_commandClass)];
+
+            // A slot may have been released since the caller's TryAcquire.
+            admitted = AdmitWaiters();
+
+            if (!admitted.empty())
+            {
+                m_capacityChanged.notify_all();
+            }
+        }
+
+        for (auto& onWaiterAdmitted : admitted)
+        {
+            onWaiterAdmitted();
+        }
+    }
+
+    bool AdmissionController::Withdraw(const std::shared_ptr<Waiter>& waiter)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        switch (waiter->m_state)
+        {
+            case Waiter::State::Admitted:
+                return false;
+
+            case Waiter::State::Queued:
+                m_waiters.erase(std::find(m_waiters.begin(), m_waiters.end(), waiter));
+                --m_classWaiting[ClassIndex(waiter->m_commandClass)];
+                m_capacityChanged.notify_all();
+                break;
+
+            case Waiter::State::Created:
+            case Waiter::State::Withdrawn:
+                break;
+        }
+
+        waiter->m_state = Waiter::State::Withdrawn;
+        return true;
+    }
+
+    void AdmissionController::Release(
+        CommandClass commandClass, std::chrono::steady_clock::duration latency, bool isOverloaded)
+    {
+        std::vector<std::function<void()>> admitted;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            --m_inFlight;
+            --m_classInFlight[ClassIndex(commandClass)];
+
+            if (m_isAdaptive)
+            {
+                AdaptLimit(latency, isOverloaded);
+            }
+
+            admitted = AdmitWaiters();
+            m_capacityChanged.notify_all();
+        }
+
+        for (auto& onWaiterAdmitted : admitted)
+        {
+            onWaiterAdmitted();
+        }
+    }
+
+    void AdmissionController::WaitForCapacity(CommandClass commandClass)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_capacityChanged.wait(lock,
+            [this, commandClass]() {
+                return m_classWaiting[ClassIndex(commandClass)] == 0 && HasCapacity(commandClass);
+            });
+    }
+
+    AdmissionMetrics AdmissionController::GetMetrics() const
+    {
+        using namespace std::chrono;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        AdmissionMetrics metrics;
+        metrics.inFlightRequests = m_inFlight;
+        metrics.queuedRequests = static_cast<int32_t>(m_waiters.size());
+        metrics.concurrencyLimit = static_cast<int32_t>(m_limit);
+        metrics.delayedRequests = m_delayedRequests;
+        metrics.totalWaitTime = duration_cast<microseconds>(m_totalWaitTime);
+        metrics.maxWaitTime = duration_cast<microseconds>(m_maxWaitTime);
+        return metrics;
+    }
+
+    bool AdmissionController::HasCapacity(CommandClass commandClass) const
+    {
+        const size_t classIndex = ClassIndex(commandClass);
+
+        if (m_maxInFlight > 0 && m_inFlight >= std::max(static_cast<int32_t>(m_limit), 1))
+        {
+            return false;
+        }
+
+        return m_classLimits[classIndex] == 0 || m_classInFlight[classIndex] < m_classLimits[classIndex];
+    }
+
+    void AdmissionController::Acquire(CommandClass commandClass)
+    {
+        ++m_inFlight;
+        ++m_classInFlight[ClassIndex(commandClass)];
+    }
+
+    void AdmissionController::AdaptLimit(std::chrono::steady_clock::duration latency, bool isOverloaded)
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        if (m_baselineLatency.count() == 0 || latency < m_baselineLatency)
+        {
+            m_baselineLatency = latency;
+        }
+        else
+        {
+            m_baselineLatency += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                (latency - m_baselineLatency) * BASELINE_DRIFT);
+        }
+
+        // Below 1 when the latency is inflated by requests queueing up on the server.
+        const std::chrono::duration<double> latencySeconds = latency;
+        const std::chrono::duration<double> baselineSeconds = m_baselineLatency;
+        const double gradient = latencySeconds.count() > 0.0
+            ? LATENCY_TOLERANCE * baselineSeconds.count() / latencySeconds.count()
+            : 1.0;
+
+        if (isOverloaded || gradient < 1.0)
+        {
+            // One decrease per round trip: the requests that were already in flight report the same congestion.
+            if (now - m_lastDecrease >= latency)
+            {
+                const double backoff =
+                    isOverloaded ? MIN_LIMIT_BACKOFF : std::clamp(gradient, MIN_LIMIT_BACKOFF, MAX_LIMIT_BACKOFF);
+                m_limit = std::max(1.0, std::floor(m_limit * backoff));
+                m_lastDecrease = now;
+            }
+        }
+        else
+        {
+            m_limit = std::min(static_cast<double>(m_maxInFlight), m_limit + 1.0 / m_limit);
+        }
+    }
+
+    int64_t AdmissionController::EffectivePriority(
+        const Waiter& waiter, std::chrono::steady_clock::time_point now) const
+    {
+        // Lower is more urgent, like the values of RequestPriority.
+        return static_cast<int64_t>(waiter.m_priority) - (now - waiter.m_enqueuedAt) / m_agingInterval;
+    }
+
+    std::vector<std::function<void()>> AdmissionController::AdmitWaiters()
+    {
+        std::vector<std::function<void()>> admitted;
+        const auto now = std::chrono::steady_clock::now();
+
+        while (!m_waiters.empty())
+        {
+            if (m_maxInFlight > 0 && m_inFlight >= std::max(static_cast<int32_t>(m_limit), 1))
+            {
+                break;
+            }
+
+            // The queue is in the order of arrival, so the first of the most urgent waiters wins.
+            auto selected = m_waiters.end();
+            int64_t selectedPriority = 0;
+
+            for (auto it = m_waiters.begin(); it != m_waiters.end(); ++it)
+            {
+                if (!HasCapacity((*it)->m_commandClass))
+                {
+                    continue;
+                }
+
+                const int64_t priority = EffectivePriority(**it, now);
+
+                if (selected == m_waiters.end() || priority < selectedPriority)
+                {
+                    selected = it;
+                    selectedPriority = priority;
+                }
+            }
+
+            if (selected == m_waiters.end())
+            {
+                break;
+            }
+
+            Waiter& waiter = **selected;
+
+            Acquire(waiter.m_commandClass);
+            --m_classWaiting[ClassIndex(waiter.m_commandClass)];
+            waiter.m_state = Waiter::State::Admitted;
+
+            const auto waitTime = now - waiter.m_enqueuedAt;
+            ++m_delayedRequests;
+            m_totalWaitTime += waitTime;
+            m_maxWaitTime = std::max(m_maxWaitTime, waitTime);
+
+            admitted.push_back(std::move(waiter.m_onAdmitted));
+            m_waiters.erase(selected);
+        }
+
+        return admitted;
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,142 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Admission control of the PTSL client: limits the number of requests sent to the server at the same time.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CppPTSLCommon.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Slots for the requests in flight: one global limit, optionally adaptive, plus fixed limits per command class.
+     *
+     * A request that doesn't get a slot waits in a queue. Released slots go to the waiters with the highest
+     * priority that fit, in the order they were queued, so a waiter blocked by its class limit doesn't hold back
+     * the requests of other classes. Waiting raises the priority, so bulk requests can't starve.
+     */
+    class AdmissionController
+    {
+    public:
+        /**
+         * Request waiting for a slot. Owned by the request and by the queue.
+         */
+        struct Waiter
+        {
+            enum class State
+            {
+                Created,
+                Queued,
+                Admitted,
+                Withdrawn
+            };
+
+            CommandClass m_commandClass;
+            RequestPriority m_priority;
+            std::function<void()> m_onAdmitted;
+            std::chrono::steady_clock::time_point m_enqueuedAt;
+            State m_state = State::Created;
+        };
+
+        /**
+         * @param maxInFlight Global limit; 0 leaves only the class limits.
+         * @param classLimits Limits of the command classes; values below 1 are ignored.
+         * @param isAdaptive Adapts the global limit to the observed latency, with maxInFlight as the upper bound.
+         * @param agingInterval Waiting time that raises the priority of a waiter by one level.
+         */
+        AdmissionController(int32_t maxInFlight,
+            const std::map<CommandClass, int32_t>& classLimits,
+            bool isAdaptive,
+            std::chrono::milliseconds agingInterval);
+
+        AdmissionController(const AdmissionController&) = delete;
+        AdmissionController& operator=(const AdmissionController&) = delete;
+
+        /**
+         * Takes a slot if one is free and nobody of the class is waiting for it.
+         */
+        bool TryAcquire(CommandClass commandClass);
+
+        /**
+         * Creates the waiter of a request that didn't get a slot from TryAcquire. onAdmitted is called once
+         * the request got a slot, possibly from another thread, without the internal lock held.
+         */
+        static std::shared_ptr<Waiter> CreateWaiter(
+            CommandClass commandClass, RequestPriority priority, std::function<void()> onAdmitted);
+
+        /**
+         * Queues the waiter, or admits it right away if a slot was released in the meantime.
+         * Does nothing if the waiter was withdrawn before.
+         */
+        void Enqueue(const std::shared_ptr<Waiter>& waiter);
+
+        /**
+         * Removes the waiter from the queue, or makes sure it's never queued.
+         * Returns false if it has already been admitted, i.e. owns a slot.
+         */
+        bool Withdraw(const std::shared_ptr<Waiter>& waiter);
+
+        /**
+         * Frees the slot of a finished request and admits the next waiters.
+         *
+         * @param latency Time from the admission to the end of the request.
+         * @param isOverloaded The request failed in a way that suggests the server is overloaded, e.g. timed out.
+         */
+        void Release(CommandClass commandClass, std::chrono::steady_clock::duration latency, bool isOverloaded);
+
+        /**
+         * Blocks while a request of the class would have to wait for a slot.
+         */
+        void WaitForCapacity(CommandClass commandClass);
+
+        AdmissionMetrics GetMetrics() const;
+
+    private:
+        static constexpr size_t CLASS_COUNT = 3;
+
+        /// Requires m_mutex.
+        bool HasCapacity(CommandClass commandClass) const;
+        void Acquire(CommandClass commandClass);
+        void AdaptLimit(std::chrono::steady_clock::duration latency, bool isOverloaded);
+        int64_t EffectivePriority(const Waiter& waiter, std::chrono::steady_clock::time_point now) const;
+        std::vector<std::function<void()>> AdmitWaiters();
+
+        const int32_t m_maxInFlight;
+        const bool m_isAdaptive;
+        const std::chrono::steady_clock::duration m_agingInterval;
+        std::array<int32_t, CLASS_COUNT> m_classLimits {};
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_capacityChanged;
+
+        std::deque<std::shared_ptr<Waiter>> m_waiters;
+        int32_t m_inFlight = 0;
+        std::array<int32_t, CLASS_COUNT> m_classInFlight {};
+        std::array<int32_t, CLASS_COUNT> m_classWaiting {};
+
+        /// Adaptive limit, kept fractional so the additive increase can be spread over a whole window of requests.
+        double m_limit = 0.0;
+        std::chrono::steady_clock::duration m_baselineLatency {};
+        std::chrono::steady_clock::time_point m_lastDecrease;
+
+        uint64_t m_delayedRequests = 0;
+        std::chrono::steady_clock::duration m_totalWaitTime {};
+        std::chrono::steady_clock::duration m_maxWaitTime {};
+    };
+} // namespace PTSLC_CPP
@@ -0,0 +1,74 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLArenaPool.h
+ */
+
+#include "CppPTSLArenaPool.h"
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        google::protobuf::ArenaOptions MakeArenaOptions(char* initialBlock, size_t initialBlockSize)
+        {
+            google::protobuf::ArenaOptions options;
+            options.initial_block = initialBlock;
+            options.initial_block_size = initialBlockSize;
+            return options;
+        }
+    } // namespace
+
+    ArenaPool::Entry::Entry(size_t initialBlockSize)
+        : m_initialBlock(new char[initialBlockSize]),
+          m_arena(MakeArenaOptions(m_initialBlock.get(), initialBlockSize))
+    {
+    }
+
+    ArenaPool::ArenaPool(size_t initialBlockSize, size_t maxIdleArenas)
+        : m_initialBlockSize(initialBlockSize),
+          m_maxIdleArenas(maxIdleArenas)
+    {
+        m_idleEntries.reserve(maxIdleArenas);
+    }
+
+    ArenaPool::ArenaLease ArenaPool::Acquire()
+    {
+        std::unique_ptr<Entry> entry;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_idleEntries.empty())
+            {
+                entry = std::move(m_idleEntries.back());
+                m_idleEntries.pop_back();
+            }
+        }
+
+        if (!entry)
+        {
+            entry = std::make_unique<Entry>(m_initialBlockSize);
+        }
+
+        Entry* leased = entry.release();
+        return ArenaLease { &leased->m_arena, Releaser { this, leased } };
+    }
+
+    void ArenaPool::Release(Entry* entry)
+    {
+        std::unique_ptr<Entry> released { entry };
+
+        // Destroys the messages and frees the blocks allocated after the initial one.
+        released->m_arena.Reset();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_idleEntries.size() < m_maxIdleArenas)
+        {
+            m_idleEntries.push_back(std::move(released));
+        }
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,88 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Pool of protobuf arenas the messages of the asynchronous calls are allocated on.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+
+namespace PTSLC_CPP
+{
+    /**
+     * Reusable google::protobuf::Arena objects, each one with its own initial block.
+     *
+     * A request allocates its ptsl::Request and ptsl::Response messages on an arena leased for its lifetime.
+     * Releasing the lease resets the arena, which keeps the initial block, so a request that fits in the block
+     * allocates its messages without touching the heap.
+     */
+    class ArenaPool
+    {
+        struct Entry;
+
+    public:
+        class Releaser
+        {
+        public:
+            Releaser() = default;
+            Releaser(ArenaPool* pool, Entry* entry) : m_pool(pool), m_entry(entry)
+            {
+            }
+
+            void operator()(google::protobuf::Arena*) const
+            {
+                m_pool->Release(m_entry);
+            }
+
+        private:
+            ArenaPool* m_pool = nullptr;
+            Entry* m_entry = nullptr;
+        };
+
+        /**
+         * Arena of one request. Must be released before the pool is destroyed.
+         */
+        using ArenaLease = std::unique_ptr<google::protobuf::Arena, Releaser>;
+
+        /**
+         * @param initialBlockSize Size of the block each arena starts with and keeps between requests.
+         * @param maxIdleArenas Arenas released while the pool already holds this many idle ones are destroyed.
+         */
+        ArenaPool(size_t initialBlockSize, size_t maxIdleArenas);
+
+        ArenaPool(const ArenaPool&) = delete;
+        ArenaPool& operator=(const ArenaPool&) = delete;
+
+        /**
+         * Returns an idle arena, or creates a new one if there are none. Thread safe.
+         */
+        ArenaLease Acquire();
+
+    private:
+        struct Entry
+        {
+            explicit Entry(size_t initialBlockSize);
+
+            /// Not owned by the arena, so Reset keeps it.
+            std::unique_ptr<char[]> m_initialBlock;
+            google::protobuf::Arena m_arena;
+        };
+
+        void Release(Entry* entry);
+
+        const size_t m_initialBlockSize;
+        const size_t m_maxIdleArenas;
+
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<Entry>> m_idleEntries;
+    };
+} // namespace PTSLC_CPP
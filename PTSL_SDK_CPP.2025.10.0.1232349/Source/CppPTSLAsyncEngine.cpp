@@ -0,0 +1,206 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLAsyncEngine.h
+ */
+
+#include "CppPTSLAsyncEngine.h"
+
+#include <algorithm>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        thread_local const AsyncEngine* tPollerOwner = nullptr;
+    }
+
+    AsyncStreamingCall::AsyncStreamingCall(std::shared_ptr<grpc::ClientContext> grpcContext,
+        ptsl::Response* grpcResponse,
+        ReadHandler onRead,
+        FinishHandler onFinish)
+        : m_grpcContext(std::move(grpcContext)),
+          m_grpcResponse(grpcResponse),
+          m_onRead(std::move(onRead)),
+          m_onFinish(std::move(onFinish))
+    {
+    }
+
+    void AsyncStreamingCall::Start(
+        ptsl::PTSL::Stub& stub, const ptsl::Request& grpcRequest, grpc::CompletionQueue& completionQueue)
+    {
+        m_state = CallState::Starting;
+        m_reader = stub.PrepareAsyncSendGrpcStreamingRequest(m_grpcContext.get(), grpcRequest, &completionQueue);
+        m_reader->StartCall(this);
+    }
+
+    void AsyncStreamingCall::Proceed(bool ok)
+    {
+        switch (m_state)
+        {
+            case CallState::Starting:
+            case CallState::Reading:
+                if (!ok)
+                {
+                    // Either the call could not be started or the stream is over: collect the final status.
+                    m_state = CallState::Finishing;
+                    m_reader->Finish(&m_grpcStatus, this);
+                    break;
+                }
+
+                if (m_state == CallState::Reading && m_onRead)
+                {
+                    m_onRead(*m_grpcResponse);
+                }
+
+                m_state = CallState::Reading;
+                m_reader->Read(m_grpcResponse, this);
+                break;
+
+            case CallState::Finishing:
+                if (m_onFinish)
+                {
+                    m_onFinish(m_grpcStatus);
+                }
+
+                delete this;
+                break;
+        }
+    }
+
+    AsyncUnaryCall::AsyncUnaryCall(std::shared_ptr<grpc::ClientContext> grpcContext,
+        ptsl::Response* grpcResponse,
+        ReadHandler onRead,
+        FinishHandler onFinish)
+        : m_grpcContext(std::move(grpcContext)),
+          m_grpcResponse(grpcResponse),
+          m_onRead(std::move(onRead)),
+          m_onFinish(std::move(onFinish))
+    {
+    }
+
+    void AsyncUnaryCall::Start(
+        ptsl::PTSL::Stub& stub, const ptsl::Request& grpcRequest, grpc::CompletionQueue& completionQueue)
+    {
+        m_reader = stub.PrepareAsyncSendGrpcRequest(m_grpcContext.get(), grpcRequest, &completionQueue);
+        m_reader->StartCall();
+        m_reader->Finish(m_grpcResponse, &m_grpcStatus, this);
+    }
+
+    void AsyncUnaryCall::Proceed(bool /*ok*/)
+    {
+        // Finish always completes with ok == true; the outcome of the call is in the status.
+        if (m_grpcStatus.ok() && m_onRead)
+        {
+            m_onRead(*m_grpcResponse);
+        }
+
+        if (m_onFinish)
+        {
+            m_onFinish(m_grpcStatus);
+        }
+
+        delete this;
+    }
+
+    AsyncAlarm::AsyncAlarm(FireHandler onFire) : m_onFire(std::move(onFire))
+    {
+    }
+
+    void AsyncAlarm::Set(grpc::CompletionQueue& completionQueue, std::chrono::system_clock::time_point deadline)
+    {
+        m_alarm.Set(&completionQueue, deadline, this);
+    }
+
+    void AsyncAlarm::Cancel()
+    {
+        m_alarm.Cancel();
+    }
+
+    void AsyncAlarm::Proceed(bool ok)
+    {
+        if (m_onFire)
+        {
+            m_onFire(ok);
+        }
+
+        delete this;
+    }
+
+    AsyncEngine::AsyncEngine(size_t pollerCount)
+    {
+        pollerCount = std::max<size_t>(pollerCount, 1);
+
+        m_completionQueues.reserve(pollerCount);
+        m_pollers.reserve(pollerCount);
+
+        for (size_t i = 0; i < pollerCount; ++i)
+        {
+            m_completionQueues.push_back(std::make_unique<grpc::CompletionQueue>());
+        }
+
+        for (auto& completionQueue : m_completionQueues)
+        {
+            m_pollers.emplace_back([this, &queue = *completionQueue]() { Poll(queue); });
+        }
+    }
+
+    AsyncEngine::~AsyncEngine()
+    {
+        Shutdown();
+    }
+
+    grpc::CompletionQueue& AsyncEngine::NextCompletionQueue()
+    {
+        const size_t index = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_completionQueues.size();
+        return *m_completionQueues[index];
+    }
+
+    void AsyncEngine::Shutdown()
+    {
+        if (m_isShutdown.exchange(true))
+        {
+            return;
+        }
+
+        for (auto& completionQueue : m_completionQueues)
+        {
+            completionQueue->Shutdown();
+        }
+
+        for (auto& poller : m_pollers)
+        {
+            if (poller.joinable())
+            {
+                poller.join();
+            }
+        }
+    }
+
+    bool AsyncEngine::IsPollerThread() const
+    {
+        return tPollerOwner == this;
+    }
+
+    size_t AsyncEngine::DefaultPollerCount()
+    {
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+        return std::clamp<size_t>(hardwareThreads / 2, 1, 4);
+    }
+
+    void AsyncEngine::Poll(grpc::CompletionQueue& completionQueue)
+    {
+        tPollerOwner = this;
+
+        void* tag = nullptr;
+        bool ok = false;
+
+        // Next returns false only after Shutdown was called and the queue is fully drained.
+        while (completionQueue.Next(&tag, &ok))
+        {
+            static_cast<AsyncCallTag*>(tag)->Proceed(ok);
+        }
+    }
+} // namespace PTSLC_CPP
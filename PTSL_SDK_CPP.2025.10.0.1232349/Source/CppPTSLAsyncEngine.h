@@ -0,0 +1,206 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Completion-queue-driven engine for the asynchronous PTSL gRPC calls.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/alarm.h>
+#include <grpcpp/grpcpp.h>
+
+#include "PTSL.grpc.pb.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Base class for all tags that are posted to the engine's completion queues.
+     * Every completed operation is routed back to the tag's Proceed method on one of the poller threads.
+     */
+    class AsyncCallTag
+    {
+    public:
+        virtual ~AsyncCallTag() = default;
+
+        /**
+         * Advances the state machine of the call.
+         *
+         * @param ok Result of the completed operation as reported by grpc::CompletionQueue::Next.
+         */
+        virtual void Proceed(bool ok) = 0;
+    };
+
+    /**
+     * Tag state machine of a single server-streaming SendGrpcStreamingRequest call.
+     *
+     * StartCall -> Read (repeated while messages arrive) -> Finish -> done.
+     * The call deletes itself once the final status is delivered.
+     */
+    class AsyncStreamingCall : public AsyncCallTag
+    {
+    public:
+        using ReadHandler = std::function<void(ptsl::Response&)>;
+        using FinishHandler = std::function<void(const grpc::Status&)>;
+
+        /**
+         * @param grpcContext Context of the call. May alias a bigger structure that must outlive the call.
+         * @param grpcResponse Message the responses are read into, e.g. allocated on the request's arena.
+         * Must outlive the call.
+         */
+        AsyncStreamingCall(std::shared_ptr<grpc::ClientContext> grpcContext,
+            ptsl::Response* grpcResponse,
+            ReadHandler onRead,
+            FinishHandler onFinish);
+
+        /**
+         * Starts the call on the given completion queue. After this call the object is owned by the engine.
+         */
+        void Start(ptsl::PTSL::Stub& stub, const ptsl::Request& grpcRequest, grpc::CompletionQueue& completionQueue);
+
+        void Proceed(bool ok) override;
+
+    private:
+        enum class CallState
+        {
+            Starting,
+            Reading,
+            Finishing
+        };
+
+        CallState m_state = CallState::Starting;
+
+        /// Keeps the RPC context alive until the call is finished.
+        std::shared_ptr<grpc::ClientContext> m_grpcContext;
+
+        std::unique_ptr<grpc::ClientAsyncReader<ptsl::Response>> m_reader;
+        ptsl::Response* m_grpcResponse = nullptr;
+        grpc::Status m_grpcStatus;
+
+        ReadHandler m_onRead;
+        FinishHandler m_onFinish;
+    };
+
+    /**
+     * Tag of a single unary SendGrpcRequest call.
+     *
+     * StartCall and Finish are issued together, so the call completes with a single tag.
+     * The read handler receives the only response of the call if the call succeeded.
+     * The call deletes itself once the final status is delivered.
+     */
+    class AsyncUnaryCall : public AsyncCallTag
+    {
+    public:
+        using ReadHandler = AsyncStreamingCall::ReadHandler;
+        using FinishHandler = AsyncStreamingCall::FinishHandler;
+
+        /**
+         * @param grpcContext Context of the call. May alias a bigger structure that must outlive the call.
+         * @param grpcResponse Message the responses are read into, e.g. allocated on the request's arena.
+         * Must outlive the call.
+         */
+        AsyncUnaryCall(std::shared_ptr<grpc::ClientContext> grpcContext,
+            ptsl::Response* grpcResponse,
+            ReadHandler onRead,
+            FinishHandler onFinish);
+
+        /**
+         * Starts the call on the given completion queue. After this call the object is owned by the engine.
+         */
+        void Start(ptsl::PTSL::Stub& stub, const ptsl::Request& grpcRequest, grpc::CompletionQueue& completionQueue);
+
+        void Proceed(bool ok) override;
+
+    private:
+        /// Keeps the RPC context alive until the call is finished.
+        std::shared_ptr<grpc::ClientContext> m_grpcContext;
+
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ptsl::Response>> m_reader;
+        ptsl::Response* m_grpcResponse = nullptr;
+        grpc::Status m_grpcStatus;
+
+        ReadHandler m_onRead;
+        FinishHandler m_onFinish;
+    };
+
+    /**
+     * One-shot timer delivered through a completion queue, e.g. to wait between two attempts of a request.
+     * The alarm deletes itself after the handler is called.
+     */
+    class AsyncAlarm : public AsyncCallTag
+    {
+    public:
+        /**
+         * Called with true when the alarm expired and with false when it was cancelled.
+         */
+        using FireHandler = std::function<void(bool isExpired)>;
+
+        explicit AsyncAlarm(FireHandler onFire);
+
+        void Set(grpc::CompletionQueue& completionQueue, std::chrono::system_clock::time_point deadline);
+
+        /**
+         * Fires the alarm immediately with isExpired == false. Thread safe; has no effect after the alarm fired.
+         */
+        void Cancel();
+
+        void Proceed(bool ok) override;
+
+    private:
+        grpc::Alarm m_alarm;
+        FireHandler m_onFire;
+    };
+
+    /**
+     * Small fixed pool of poller threads, each one draining its own grpc::CompletionQueue.
+     * Calls are spread over the queues in a round-robin manner.
+     */
+    class AsyncEngine
+    {
+    public:
+        explicit AsyncEngine(size_t pollerCount);
+        ~AsyncEngine();
+
+        AsyncEngine(const AsyncEngine&) = delete;
+        AsyncEngine& operator=(const AsyncEngine&) = delete;
+
+        /**
+         * Returns the completion queue the next call should be started on.
+         */
+        grpc::CompletionQueue& NextCompletionQueue();
+
+        /**
+         * Shuts down all completion queues and joins the poller threads.
+         * All calls must be finished or cancelled before, otherwise this method waits for them.
+         */
+        void Shutdown();
+
+        /**
+         * Returns true if the current thread is one of the engine's poller threads.
+         */
+        bool IsPollerThread() const;
+
+        /**
+         * Default number of poller threads used when the client configuration doesn't specify it.
+         */
+        static size_t DefaultPollerCount();
+
+    private:
+        void Poll(grpc::CompletionQueue& completionQueue);
+
+        std::vector<std::unique_ptr<grpc::CompletionQueue>> m_completionQueues;
+        std::vector<std::thread> m_pollers;
+        std::atomic<size_t> m_nextQueue { 0 };
+        std::atomic<bool> m_isShutdown { false };
+    };
+} // namespace PTSLC_CPP
@@ -37,12 +37,10 @@ namespace PTSLC_CPP
 
             handler->CreateState();
 
-            // TODO: After removing deprecated CppPTSLC handlers, stop converting request bodies to json back and forth;
-            //       pass direct_json_body directly to the server instead.
             handler->ConvertRequestBodyToJson(requestBodyJson);
 
             callData->m_grpcRequest.mutable_header()->set_task_id("");
-            callData->m_grpcRequest.mutable_header()->set_session_id(SessionId);
+            callData->m_grpcRequest.mutable_header()->set_session_id(m_internalData->m_sessionId.Load());
             callData->m_grpcRequest.mutable_header()->set_command(static_cast<ptsl::CommandId>(commandType));
             callData->m_grpcRequest.mutable_header()->set_version(5);  // stick to the legacy version 2024.10
             callData->m_grpcRequest.mutable_header()->set_version_minor(0);
@@ -53,12 +51,13 @@ namespace PTSLC_CPP
                 &callData->m_context, callData->m_grpcRequest, &(m_internalData->m_completionQueue));
             asyncReader->Finish(&callData->m_grpcResponse, &callData->m_grpcStatus, callData.get());
 
-            void* gotTag;
-            bool canReadNext;
+            // the poller thread of the completion queue delivers the result of this very call
+            bool canReadNext = callData->WaitForCompletion();
 
-            bool isNextResponseExist = m_internalData->m_completionQueue.Next(&gotTag, &canReadNext);
+            // the call is finished, and even a failed command may have changed something
+            EvictStaleResponses(commandType);
 
-            if (isNextResponseExist && canReadNext && gotTag == static_cast<void*>(callData.get()))
+            if (canReadNext)
             {
                 if (callData->m_grpcStatus.ok())
                 {
@@ -165,6 +164,8 @@ namespace PTSLC_CPP
             return;
         }
 
+        uint64_t taskWatchId = 0;
+
         try
         {
             auto callData = std::make_unique<CallData>();
@@ -173,12 +174,10 @@ namespace PTSLC_CPP
 
             handler->CreateState();
 
-            // TODO: After removing deprecated CppPTSLC handlers, stop converting request bodies to json back and forth;
-            //       pass direct_json_body directly to the server instead.
             handler->ConvertRequestBodyToJson(requestBodyJson);
 
             callData->m_grpcRequest.mutable_header()->set_task_id("");
-            callData->m_grpcRequest.mutable_header()->set_session_id(SessionId);
+            callData->m_grpcRequest.mutable_header()->set_session_id(m_internalData->m_sessionId.Load());
             callData->m_grpcRequest.mutable_header()->set_command(static_cast<ptsl::CommandId>(commandType));
             callData->m_grpcRequest.mutable_header()->set_version(5);  // stick to the legacy version 2024.10
             callData->m_grpcRequest.mutable_header()->set_version_minor(0);
@@ -188,25 +187,22 @@ namespace PTSLC_CPP
             auto asyncStreamReader = m_internalData->m_client->AsyncSendGrpcStreamingRequest(
                 &callData->m_context, callData->m_grpcRequest, &(m_internalData->m_completionQueue), callData.get());
 
-            void* gotTag;
-            bool canReadNext;
-
-            bool isNextResponseExist = m_internalData->m_completionQueue.Next(&gotTag, &canReadNext);
+            // the poller thread of the completion queue delivers the results of this very call
+            bool canReadNext = callData->WaitForCompletion();
 
-            if (isNextResponseExist && canReadNext && gotTag == static_cast<void*>(callData.get()))
+            if (canReadNext)
             {
+                // becomes ready once the watched task is finished; holds an exception if it failed
                 std::future<void> pingTask;
-                std::promise<void> pingCancellationSignal;
 
                 while (true)
                 {
                     asyncStreamReader->Read(&callData->m_grpcResponse, callData.get());
 
-                    // check if completion queue contains one more available response
-                    canReadNext = false;
-                    isNextResponseExist = m_internalData->m_completionQueue.Next(&gotTag, &canReadNext);
+                    // check if the stream delivered one more response
+                    canReadNext = callData->WaitForCompletion();
 
-                    if (!isNextResponseExist || !canReadNext || gotTag != static_cast<void*>(callData.get()))
+                    if (!canReadNext)
                     {
                         break;
                     }
@@ -222,15 +218,36 @@ namespace PTSLC_CPP
                         // ping task status if needed
                         if (handler->IsNeedToPingTaskStatus())
                         {
-                            if (handler->GetResponseStatus() == TaskStatus::TStatus_Queued)
+                            if (handler->GetResponseStatus() == TaskStatus::TStatus_Queued && !taskWatchId)
                             {
-                                // start pinging current task execution status
-                                std::future<void> pingCancellationToken = pingCancellationSignal.get_future();
-                                pingTask = std::async(std::launch::async,
-                                    &CppPTSLClient::PingTaskStatus,
-                                    this,
-                                    callData->m_grpcResponse.header().task_id(),
-                                    std::move(pingCancellationToken));
+                                // watch current task execution status on the shared task monitor
+                                auto taskResult = std::make_shared<std::promise<void>>();
+                                pingTask = taskResult->get_future();
+
+                                taskWatchId = WatchTask(callData->m_grpcResponse.header().task_id(),
+                                    [taskResult](const TaskStatusUpdate& update)
+                                    {
+                                        if (update.status == TaskStatus::TStatus_Failed)
+                                        {
+                                            taskResult->set_exception(std::make_exception_ptr(std::runtime_error(
+                                                "Task status polling canceled. GetTaskStatus returned status Failed "
+                                                "for the task with task ID: "
+                                                + update.taskId)));
+                                        }
+                                        else if (update.status == TaskStatus::TStatus_CompletedWithBadResponse
+                                            || update.status == TaskStatus::TStatus_FailedWithBadErrorResponse)
+                                        {
+                                            SafeLogger::SyncPrint(
+                                                "Task status polling canceled. GetTaskStatus returned incorrect "
+                                                "response JSON. Status: "
+                                                + std::to_string(static_cast<int32_t>(update.status)));
+                                            taskResult->set_value();
+                                        }
+                                        else if (update.status == TaskStatus::TStatus_Completed)
+                                        {
+                                            taskResult->set_value();
+                                        }
+                                    });
                             }
                         }
 
@@ -287,17 +304,21 @@ namespace PTSLC_CPP
                             || handler->GetResponseStatus() == TaskStatus::TStatus_CompletedWithBadResponse
                             || handler->GetResponseStatus() == TaskStatus::TStatus_FailedWithBadErrorResponse)
                         {
-                            // cancel ping task
-                            pingCancellationSignal.set_value();
+                            // stop watching the task
+                            StopWatchingTask(taskWatchId);
+                            taskWatchId = 0;
                         }
 
-                        if (IsCancellationRequested(pingTask))
+                        if (pingTask.valid() && IsCancellationRequested(pingTask))
                         {
-                            // get results of the ping task if available (canceled or got exception)
+                            // get the result of the watched task if available (finished or failed)
                             pingTask.get();
                         }
                     }
                 }
+
+                StopWatchingTask(taskWatchId);
+                EvictStaleResponses(commandType);
             }
             else
             {
@@ -306,6 +327,11 @@ namespace PTSLC_CPP
         }
         catch (const std::exception& ex)
         {
+            StopWatchingTask(taskWatchId);
+
+            // even a failed command may have changed something
+            EvictStaleResponses(commandType);
+
             auto response = std::make_shared<CommandResponse>();
 
             response->header.commandType = commandType;
@@ -25,8 +25,7 @@
     {                                                                                                                  \
     }
 
-// Indeed, parsing `mGrpcRequestBody` from JSON to convert it later back to JSON may seem peculiar.
-// However, this method ensures a consistent process for all scenarios further on, whether it's JSON or command line.
+// A direct JSON body is sent as is; `mGrpcRequestBody` is only filled from the request fields otherwise.
 
 // Deprecated starting in 2024.10
 //  Please use a general JSON-based @ref PTSLC_CPP::CppPTSLClient::SendRequest "SendRequest" function,
@@ -38,12 +37,7 @@
                                                                                                                        \
     CMD##Handler(const CMD##Request& request)                                                                          \
     {                                                                                                                  \
-        std::string jsonBody = request.directJsonBody;                                                                 \
-        if (!jsonBody.empty() && !std::all_of(jsonBody.begin(), jsonBody.end(), isspace))                              \
-        {                                                                                                              \
-            google::protobuf::util::JsonStringToMessage(jsonBody, &mGrpcRequestBody);                                  \
-        }                                                                                                              \
-        else                                                                                                           \
+        if (!this->SetDirectJsonBody(request.directJsonBody))                                                          \
         {                                                                                                              \
             this->FillGrpcRequest(request);                                                                            \
         }                                                                                                              \
@@ -108,20 +102,48 @@ namespace PTSLC_CPP
         {
         }
 
+        /**
+         * Returns the direct JSON body if there is one, else the request body serialized as compact JSON.
+         */
         bool ConvertRequestBodyToJson(std::string& requestBodyJSON)
         {
+            if (!mDirectJsonBody.empty())
+            {
+                requestBodyJSON = mDirectJsonBody;
+                return true;
+            }
+
             bool status = false;
 
-            JsonOptions jOpts = DefaultJsonWriteOptions();
+            JsonOptions jOpts = CompactJsonWriteOptions();
 
-            status = MessageToJsonString(GetRequestBodyRef(), &requestBodyJSON, jOpts).ok();
+            status = PrintJsonBody(GetRequestBodyRef(), &requestBodyJSON, jOpts).ok();
             return status;
         }
 
         std::tuple<bool, std::string> ConvertJsonToResponseBody(const std::string& responseBodyJSON)
         {
             JsonParseOptions jOpts = DefaultJsonParseOptions();
-            auto status = JsonStringToMessage(responseBodyJSON, &GetResponseBodyRef(), jOpts);
+            google::protobuf::Message& responseBody = GetResponseBodyRef();
+            JsonStatus status;
+
+            if (const google::protobuf::FieldDescriptor* listField = GetStreamedListField())
+            {
+                // one scratch element for the whole list
+                std::unique_ptr<google::protobuf::Message> element(
+                    responseBody.GetReflection()->GetMessageFactory()->GetPrototype(listField->message_type())->New());
+
+                status = ParseJsonListBody(responseBodyJSON,
+                    &responseBody,
+                    listField,
+                    element.get(),
+                    jOpts,
+                    [this](const google::protobuf::Message& parsed) { OnListElement(parsed); });
+            }
+            else
+            {
+                status = ParseJsonBody(responseBodyJSON, &responseBody, jOpts);
+            }
 
             bool result = status.ok();
             std::string result_str = status.ToString();
@@ -133,14 +155,14 @@ namespace PTSLC_CPP
         {
             JsonParseOptions jOpts = DefaultJsonParseOptions();
 
-            auto status = JsonStringToMessage(errorJSON, &mGrpcResponseError, jOpts);
+            auto status = ParseJsonBody(errorJSON, &mGrpcResponseError, jOpts);
             bool result = status.ok();
             std::string result_str = status.ToString();
 
             if (!status.ok())
             {
                 ptsl::CommandError legacyError;
-                auto legacy_err_status = JsonStringToMessage(errorJSON, &legacyError);
+                auto legacy_err_status = ParseJsonBody(errorJSON, &legacyError, JsonParseOptions());
                 result = legacy_err_status.ok();
                 if (legacy_err_status.ok())
                 {
@@ -175,6 +197,14 @@ namespace PTSLC_CPP
         {
         }
 
+        /**
+         * Called for each element of the list given by GetStreamedListField() while the body is parsed,
+         * before OnHasBody().
+         */
+        virtual void OnListElement(const google::protobuf::Message& /*element*/)
+        {
+        }
+
         virtual void OnNoBody()
         {
         }
@@ -266,6 +296,22 @@ namespace PTSLC_CPP
         }
 
     protected:
+        /**
+         * Keeps the JSON body given by the caller to be sent without parsing it, unless it's blank.
+         *
+         * @returns false if the body is blank and the request body has to be filled from the request instead.
+         */
+        bool SetDirectJsonBody(const std::string& jsonBody)
+        {
+            if (std::all_of(jsonBody.begin(), jsonBody.end(), isspace))
+            {
+                return false;
+            }
+
+            mDirectJsonBody = jsonBody;
+            return true;
+        }
+
         virtual google::protobuf::Message& GetRequestBodyRef()
         {
             return sEmptyMessage;
@@ -276,7 +322,17 @@ namespace PTSLC_CPP
             return sEmptyMessage;
         }
 
+        /**
+         * A long list of the response body, e.g. the tracks of GetTrackList, that is passed to OnListElement
+         * element by element instead of being kept in the body. None by default.
+         */
+        virtual const google::protobuf::FieldDescriptor* GetStreamedListField() const
+        {
+            return nullptr;
+        }
+
         ptsl::ResponseError mGrpcResponseError;
+        std::string mDirectJsonBody;
         std::shared_ptr<State> mState;
         std::shared_ptr<CommandResponse> mResponse;
 
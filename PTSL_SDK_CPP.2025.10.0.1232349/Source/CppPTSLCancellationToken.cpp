@@ -0,0 +1,80 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLCancellationToken.h
+ */
+
+#include "CppPTSLCancellationToken.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace PTSLC_CPP
+{
+    struct CancellationToken::State
+    {
+        std::mutex mMutex;
+        std::atomic<bool> mIsCancelled { false };
+        CallbackId mNextCallbackId = 1;
+        std::unordered_map<CallbackId, std::function<void()>> mCallbacks;
+    };
+
+    CancellationToken::CancellationToken()
+        : mState(std::make_shared<State>())
+    {
+    }
+
+    void CancellationToken::Cancel()
+    {
+        std::unordered_map<CallbackId, std::function<void()>> callbacks;
+
+        {
+            std::lock_guard<std::mutex> lock(mState->mMutex);
+
+            if (mState->mIsCancelled)
+            {
+                return;
+            }
+
+            mState->mIsCancelled = true;
+            callbacks.swap(mState->mCallbacks);
+        }
+
+        // Called without the lock, so a callback may use the token.
+        for (auto& callback : callbacks)
+        {
+            callback.second();
+        }
+    }
+
+    bool CancellationToken::IsCancelled() const
+    {
+        return mState->mIsCancelled;
+    }
+
+    CancellationToken::CallbackId CancellationToken::Subscribe(std::function<void()> callback) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(mState->mMutex);
+
+            if (!mState->mIsCancelled)
+            {
+                const CallbackId callbackId = mState->mNextCallbackId++;
+                mState->mCallbacks.emplace(callbackId, std::move(callback));
+                return callbackId;
+            }
+        }
+
+        callback();
+        return 0;
+    }
+
+    void CancellationToken::Unsubscribe(CallbackId callbackId) const
+    {
+        std::lock_guard<std::mutex> lock(mState->mMutex);
+        mState->mCallbacks.erase(callbackId);
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,55 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Token which cancels the requests it is attached to.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "PtslCCppExport.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Cancels the requests it is attached to with @ref PTSLC_CPP::CppPTSLRequest::SetCancellationToken
+     * "SetCancellationToken", leaving the other requests of the client running.
+     *
+     * Copies of a token share its state, so cancelling any copy cancels the requests attached to all of them.
+     * A cancelled request completes with the CEType_SDK_GrpcGeneric error.
+     */
+    class PTSLC_CPP_EXPORT CancellationToken
+    {
+    public:
+        using CallbackId = uint64_t;
+
+        CancellationToken();
+
+        /**
+         * Cancels the attached requests, including the ones attached after this call. Thread safe.
+         */
+        void Cancel();
+
+        bool IsCancelled() const;
+
+        /**
+         * Calls the callback when the token is cancelled, or right away if it already is.
+         * Used by the client to cancel the requests the token is attached to.
+         */
+        CallbackId Subscribe(std::function<void()> callback) const;
+
+        /**
+         * Removes the callback if it hasn't been called yet.
+         */
+        void Unsubscribe(CallbackId callbackId) const;
+
+    private:
+        struct State;
+        std::shared_ptr<State> mState;
+    };
+} // namespace PTSLC_CPP
@@ -0,0 +1,103 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLChannelPool.h
+ */
+
+#include "CppPTSLChannelPool.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        std::shared_ptr<grpc::Channel> CreateChannel(const std::string& address, int32_t channelIndex)
+        {
+            grpc::ChannelArguments channelArgs;
+            channelArgs.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, std::numeric_limits<int32_t>::max());
+
+            // Without these gRPC would share one subchannel (and thus one connection) between all channels
+            // created with identical arguments.
+            channelArgs.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            channelArgs.SetInt("ptslc_cpp.channel_index", channelIndex);
+
+            // gRPC backs off up to two minutes between reconnection attempts by default;
+            // a local Pro Tools coming back after a restart should be picked up within a second.
+            channelArgs.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 250);
+            channelArgs.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 1000);
+
+            return grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), channelArgs);
+        }
+    } // namespace
+
+    ChannelPool::ChannelPool(const std::string& address, size_t channelCount, bool useDedicatedStreamingChannel)
+    {
+        channelCount = std::max<size_t>(channelCount, 1);
+        int32_t channelIndex = 0;
+
+        auto createEntry = [&]()
+        {
+            auto entry = std::make_unique<Entry>();
+            entry->m_channel = CreateChannel(address, channelIndex++);
+            entry->m_stub = ptsl::PTSL::NewStub(entry->m_channel);
+            return entry;
+        };
+
+        for (size_t i = 0; i < channelCount; ++i)
+        {
+            m_channels.push_back(createEntry());
+        }
+
+        if (useDedicatedStreamingChannel)
+        {
+            m_streamingChannel = createEntry();
+        }
+    }
+
+    ChannelPool::StubLease ChannelPool::Acquire(bool isStreaming)
+    {
+        if (isStreaming && m_streamingChannel)
+        {
+            return Lease(*m_streamingChannel);
+        }
+
+        // Least outstanding requests; the counters may change concurrently, which only makes the choice approximate.
+        Entry* selected = m_channels.front().get();
+        int32_t selectedOutstanding = selected->m_outstanding.load(std::memory_order_relaxed);
+
+        for (size_t i = 1; i < m_channels.size() && selectedOutstanding > 0; ++i)
+        {
+            const int32_t outstanding = m_channels[i]->m_outstanding.load(std::memory_order_relaxed);
+
+            if (outstanding < selectedOutstanding)
+            {
+                selected = m_channels[i].get();
+                selectedOutstanding = outstanding;
+            }
+        }
+
+        return Lease(*selected);
+    }
+
+    ptsl::PTSL::Stub& ChannelPool::PrimaryStub()
+    {
+        return *m_channels.front()->m_stub;
+    }
+
+    std::shared_ptr<grpc::Channel> ChannelPool::PrimaryChannel() const
+    {
+        return m_channels.front()->m_channel;
+    }
+
+    ChannelPool::StubLease ChannelPool::Lease(Entry& entry)
+    {
+        entry.m_outstanding.fetch_add(1, std::memory_order_relaxed);
+
+        return StubLease { entry.m_stub.get(),
+            [&entry](ptsl::PTSL::Stub*) { entry.m_outstanding.fetch_sub(1, std::memory_order_relaxed); } };
+    }
+} // namespace PTSLC_CPP
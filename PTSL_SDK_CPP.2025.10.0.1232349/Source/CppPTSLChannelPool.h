@@ -0,0 +1,77 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Pool of gRPC channels (HTTP/2 connections) to the PTSL server.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "PTSL.grpc.pb.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Fixed set of channels to the same server address, each one with its own connection.
+     *
+     * Short requests are spread over the regular channels, picking the one with the least outstanding requests.
+     * Streaming requests optionally get a dedicated channel, so long exports and imports don't share
+     * flow-control windows with latency-sensitive queries.
+     */
+    class ChannelPool
+    {
+    public:
+        /**
+         * Stub of one of the pool's channels. The channel counts as busy while the lease is alive.
+         */
+        using StubLease = std::shared_ptr<ptsl::PTSL::Stub>;
+
+        /**
+         * @param address Server address.
+         * @param channelCount Number of regular channels; values below 1 are treated as 1.
+         * @param useDedicatedStreamingChannel Adds a separate channel used only by streaming requests.
+         */
+        ChannelPool(const std::string& address, size_t channelCount, bool useDedicatedStreamingChannel);
+
+        ChannelPool(const ChannelPool&) = delete;
+        ChannelPool& operator=(const ChannelPool&) = delete;
+
+        /**
+         * Picks a channel for the next request and marks it busy until the returned lease is released.
+         */
+        StubLease Acquire(bool isStreaming);
+
+        /**
+         * Stub of the first regular channel. Used by the code paths that don't track outstanding requests.
+         */
+        ptsl::PTSL::Stub& PrimaryStub();
+
+        /**
+         * The first regular channel, used to watch the connection to the server.
+         */
+        std::shared_ptr<grpc::Channel> PrimaryChannel() const;
+
+    private:
+        struct Entry
+        {
+            std::shared_ptr<grpc::Channel> m_channel;
+            std::unique_ptr<ptsl::PTSL::Stub> m_stub;
+            std::atomic<int32_t> m_outstanding { 0 };
+        };
+
+        static StubLease Lease(Entry& entry);
+
+        std::vector<std::unique_ptr<Entry>> m_channels;
+        std::unique_ptr<Entry> m_streamingChannel;
+    };
+} // namespace PTSLC_CPP
@@ -17,14 +17,22 @@
 #endif
 
 #include <algorithm>
-#include <nlohmann/json.hpp>
 #include <optional>
-
-using json = nlohmann::json;
+#include <set>
+#include <vector>
 
 namespace PTSLC_CPP
 {
-    const int32_t PING_TIMEOUT = 5000; // 5 sec in milliseconds;
+    const std::chrono::milliseconds TASK_STATUS_POLL_TIMEOUT { 5000 };
+    const std::chrono::milliseconds HOST_PROBE_TIMEOUT { 2000 };
+    const std::chrono::milliseconds CONNECTION_SETUP_TIMEOUT { 5000 };
+
+    /// Safety net for a suspended PollEvents call that missed the restoration of the connection.
+    const std::chrono::hours EVENT_STREAM_SUSPEND_LIMIT { 1 };
+
+    /// Fits the messages of a typical request and response; bigger ones spill into blocks freed with the request.
+    const size_t REQUEST_ARENA_BLOCK_SIZE = 4096;
+    const size_t MAX_IDLE_REQUEST_ARENAS = 64;
 
     /**
     * Client constructor. Used for initialization of gRPC Client and client's config.
@@ -34,13 +42,72 @@ namespace PTSLC_CPP
           m_clientConfig(config),
           m_internalData(std::make_unique<InternalData>())
     {
-        grpc::ChannelArguments channelArgs;
-        channelArgs.SetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, std::numeric_limits<int32_t>::max());
+        m_internalData->m_channelPool = std::make_unique<ChannelPool>(config.address,
+            config.channelCount > 0 ? static_cast<size_t>(config.channelCount) : 1,
+            config.useDedicatedStreamingChannel);
+        m_internalData->m_client = &m_internalData->m_channelPool->PrimaryStub();
+        m_internalData->m_retryBudget = std::make_unique<RetryBudget>(config.retryBudgetTokens, config.retryBudgetTokenRatio);
+        if (config.maxInFlightRequests > 0 || !config.maxInFlightRequestsPerClass.empty())
+        {
+            m_internalData->m_admission = std::make_unique<AdmissionController>(
+                config.maxInFlightRequests,
+                config.maxInFlightRequestsPerClass,
+                config.adaptiveConcurrency,
+                config.priorityAgingInterval);
+        }
+
+        std::map<CommandId, std::chrono::milliseconds> cacheTimeToLive;
+        for (const auto& [commandId, timeToLive] : config.responseCacheTimeToLive)
+        {
+            if (IsReadOnlyCommand(commandId) && timeToLive.count() > 0)
+            {
+                cacheTimeToLive.emplace(commandId, timeToLive);
+            }
+        }
+
+        if (!cacheTimeToLive.empty() && config.responseCacheMaxEntries > 0)
+        {
+            m_internalData->m_responseCache = std::make_unique<ResponseCache>(
+                cacheTimeToLive, static_cast<size_t>(config.responseCacheMaxEntries));
+        }
+
+        m_internalData->m_arenaPool = std::make_unique<ArenaPool>(REQUEST_ARENA_BLOCK_SIZE, MAX_IDLE_REQUEST_ARENAS);
+
+        m_internalData->m_requestHeaderPrototype.set_version(PTSL_VERSION_MAJOR);
+        m_internalData->m_requestHeaderPrototype.set_version_minor(PTSL_VERSION_MINOR);
+        m_internalData->m_requestHeaderPrototype.set_version_revision(PTSL_VERSION_REVISION);
+
+        m_internalData->m_asyncEngine = std::make_unique<AsyncEngine>(config.pollerThreadCount > 0
+                ? static_cast<size_t>(config.pollerThreadCount)
+                : AsyncEngine::DefaultPollerCount());
 
-        m_internalData->m_client = ptsl::PTSL::NewStub(
-            grpc::CreateCustomChannel(config.address, grpc::InsecureChannelCredentials(), channelArgs));
+        m_internalData->m_completionQueuePoller = std::thread(
+            [&completionQueue = m_internalData->m_completionQueue]()
+            {
+                void* tag = nullptr;
+                bool ok = false;
+
+                // Next returns false only after Shutdown was called and the queue is fully drained.
+                while (completionQueue.Next(&tag, &ok))
+                {
+                    static_cast<CallData*>(tag)->Proceed(ok);
+                }
+            });
 
-        this->Init();
+        m_internalData->m_taskMonitor = std::make_unique<TaskMonitor>(*m_internalData->m_asyncEngine,
+            [this](const std::string& taskId, TaskMonitor::PollResultHandler onPolled)
+            { PollTaskStatus(taskId, std::move(onPolled)); },
+            config.taskStatusPollInterval,
+            config.maxTaskStatusPollInterval);
+
+        if (config.deferInit)
+        {
+            m_internalData->m_initThread = std::thread([this]() { this->CompleteInit(); });
+        }
+        else
+        {
+            this->CompleteInit();
+        }
     }
 
     /**
@@ -48,11 +115,37 @@ namespace PTSLC_CPP
     */
     CppPTSLClient::~CppPTSLClient()
     {
+        m_internalData->m_isShuttingDown = true;
+
+        if (m_internalData->m_initThread.joinable())
+        {
+            // Interrupts the initial HostReadyCheck; the ones started afterwards are cancelled right away.
+            CancelRequests();
+            m_internalData->m_initThread.join();
+        }
+
+        if (m_internalData->m_connectionWatcher)
+        {
+            m_internalData->m_connectionWatcher->RequestStop();
+        }
+
         m_isHostReady = false;
 
         CancelRequests();
 
+        // Its polls started from now on are cancelled right away.
+        m_internalData->m_taskMonitor->Stop();
+
+        if (m_internalData->m_connectionWatcher)
+        {
+            m_internalData->m_connectionWatcher->Stop();
+        }
+
+        ExpirePendingRequests(true);
+
+        m_internalData->m_asyncEngine->Shutdown();
         m_internalData->m_completionQueue.Shutdown();
+        m_internalData->m_completionQueuePoller.join();
         this->Free();
     }
 
@@ -72,14 +165,12 @@ namespace PTSLC_CPP
 
     std::string CppPTSLClient::GetSessionId() const
     {
-        std::lock_guard m_sessionIdLock(CppPTSLClient::SessionIdMutex);
-        return SessionId;
+        return m_internalData->m_sessionId.Load();
     }
 
     void CppPTSLClient::SetSessionId(const std::string& sessionId)
     {
-        std::lock_guard m_sessionIdLock(CppPTSLClient::SessionIdMutex);
-        SessionId = sessionId;
+        m_internalData->m_sessionId.Store(sessionId);
     }
 
     /**
@@ -98,6 +189,88 @@ namespace PTSLC_CPP
         }
 
         this->HostReadyCheck();
+
+        m_internalData->m_connectionWatcher = std::make_unique<ConnectionWatcher>(
+            m_internalData->m_channelPool->PrimaryChannel(),
+            m_clientConfig.hostProbeInterval,
+            [this]()
+            {
+                this->HostReadyCheck();
+                return this->IsHostReady();
+            },
+            [this]()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+                    m_internalData->m_isConnectionLost = true;
+                }
+
+                this->SetHostReady(false);
+            },
+            [this]() { this->ExpirePendingRequests(); });
+
+        m_internalData->m_connectionWatcher->Start(m_isHostReady);
+    }
+
+    void CppPTSLClient::CompleteInit()
+    {
+        try
+        {
+            this->Init();
+        }
+        catch (...)
+        {
+            if (!m_clientConfig.deferInit)
+            {
+                throw;
+            }
+
+            // Without the connection watcher nobody would expire the waiting requests.
+            {
+                std::lock_guard<std::mutex> lock(m_internalData->m_pendingRequestsMutex);
+                m_internalData->m_isInitialized = true;
+            }
+
+            ExpirePendingRequests(true);
+            m_internalData->m_initPromise.set_exception(std::current_exception());
+            return;
+        }
+
+        m_internalData->m_isInitialized = true;
+        m_internalData->m_initPromise.set_value(m_isHostReady);
+    }
+
+    std::shared_future<bool> CppPTSLClient::Ready() const
+    {
+        return m_internalData->m_initFuture;
+    }
+
+    AdmissionMetrics CppPTSLClient::GetAdmissionMetrics() const
+    {
+        if (!m_internalData->m_admission)
+        {
+            return AdmissionMetrics {};
+        }
+
+        return m_internalData->m_admission->GetMetrics();
+    }
+
+    ResponseCacheMetrics CppPTSLClient::GetResponseCacheMetrics() const
+    {
+        if (!m_internalData->m_responseCache)
+        {
+            return ResponseCacheMetrics {};
+        }
+
+        return m_internalData->m_responseCache->GetMetrics();
+    }
+
+    void CppPTSLClient::ClearResponseCache()
+    {
+        if (m_internalData->m_responseCache)
+        {
+            m_internalData->m_responseCache->Clear();
+        }
     }
 
     /**
@@ -131,28 +304,192 @@ namespace PTSLC_CPP
 
         CppPTSLRequest request { CommandId::CId_HostReadyCheck };
 
+        // The check is repeated by the connection watcher, so a stalled host mustn't block it and there's no need to retry.
+        RetryPolicy retryPolicy;
+        retryPolicy.mode = RetryMode::RMode_Never;
+        request.SetRetryPolicy(retryPolicy);
+        request.SetTimeout(HOST_PROBE_TIMEOUT);
+
         auto resp = this->SendRequest(request).get();
 
+        bool isHostReady = false;
+
         // TODO: Explicit error handling
 
         // Legacy response handling
-        if (resp.GetResponseBodyJson().empty())
+        if (resp.GetResponseBodyJsonView().empty())
         {
-            this->m_isHostReady = resp.GetStatus() == CommandStatusType::Completed;
+            isHostReady = resp.GetStatus() == CommandStatusType::Completed;
         }
         // Current response handling
         else
         {
             ptsl::HostReadyCheckResponseBody grpcResponseBody;
             JsonParseOptions jOpts = DefaultJsonParseOptions();
-            if (JsonStringToMessage(resp.GetResponseBodyJson(), &grpcResponseBody, jOpts).ok())
+            if (ParseJsonBody(resp.GetResponseBodyJson(), &grpcResponseBody, jOpts).ok())
             {
-                this->m_isHostReady = grpcResponseBody.is_host_ready();
+                isHostReady = grpcResponseBody.is_host_ready();
             }
-            else
+        }
+
+        this->SetHostReady(isHostReady);
+    }
+
+    bool CppPTSLClient::IsHostReady() const
+    {
+        return m_isHostReady;
+    }
+
+    bool CppPTSLClient::WaitUntilReady(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_internalData->m_readinessMutex);
+        return m_internalData->m_readinessChanged.wait_for(lock, timeout, [this]() { return m_isHostReady.load(); });
+    }
+
+    void CppPTSLClient::SetReadinessCallback(std::function<void(bool isHostReady)> callback)
+    {
+        std::lock_guard<std::mutex> lock(m_internalData->m_readinessMutex);
+        m_internalData->m_readinessCallback = std::move(callback);
+    }
+
+    void CppPTSLClient::SetHostReady(bool isHostReady)
+    {
+        // The host stays not ready for the other requests until the session and the subscriptions are restored;
+        // the connection watcher probes again soon, which retries the restoration.
+        if (isHostReady && !m_isHostReady && m_clientConfig.autoReconnect && !RestoreConnectionSetup())
+        {
+            SafeLogger::SyncPrint("Failed to restore the connection state after a reconnect.\n");
+            return;
+        }
+
+        std::function<void(bool)> callback;
+
+        {
+            // Changed under the mutex, so WaitUntilReady can't miss the notification.
+            std::lock_guard<std::mutex> lock(m_internalData->m_readinessMutex);
+
+            if (m_isHostReady.exchange(isHostReady) == isHostReady)
+            {
+                return;
+            }
+
+            callback = m_internalData->m_readinessCallback;
+        }
+
+        m_internalData->m_readinessChanged.notify_all();
+
+        if (isHostReady)
+        {
+            std::deque<InternalData::PendingRequest> pendingRequests;
+
+            {
+                std::lock_guard<std::mutex> lock(m_internalData->m_pendingRequestsMutex);
+                pendingRequests.swap(m_internalData->m_pendingRequests);
+            }
+
+            // The most urgent requests go first, in the order they were sent.
+            std::stable_sort(pendingRequests.begin(),
+                pendingRequests.end(),
+                [](const InternalData::PendingRequest& left, const InternalData::PendingRequest& right)
+                { return left.m_request.GetPriority() < right.m_request.GetPriority(); });
+
+            for (auto& pending : pendingRequests)
+            {
+                // Dispatched directly rather than through StartRequest, which may block on the admission limits.
+                if (m_isHostReady)
+                {
+                    DispatchRequest(std::move(pending.m_request),
+                        std::move(pending.m_responseCallback),
+                        std::move(pending.m_onComplete));
+                }
+                else
+                {
+                    StartRequest(std::move(pending.m_request),
+                        std::move(pending.m_responseCallback),
+                        std::move(pending.m_onComplete));
+                }
+            }
+        }
+
+        if (callback)
+        {
+            try
+            {
+                callback(isHostReady);
+            }
+            catch (const std::exception& e)
             {
-                this->m_isHostReady = false;
+                SafeLogger::SyncPrint(std::string { "Exception in the readiness callback: " } + e.what() + "\n");
             }
+            catch (...)
+            {
+                SafeLogger::SyncPrint("Unknown exception in the readiness callback.\n");
+            }
+        }
+    }
+
+    void CppPTSLClient::FailHostNotReady(
+        CommandId commandId, const std::function<void(const CppPTSLResponse&, std::exception_ptr)>& onComplete)
+    {
+        CppPTSLResponse notReadyResponse { commandId };
+        std::exception_ptr error;
+
+        try
+        {
+            notReadyResponse = this->SendHostNotReadyResponse(commandId);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        onComplete(notReadyResponse, error);
+    }
+
+    void CppPTSLClient::ExpirePendingRequests(bool expireAll)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<InternalData::PendingRequest> expiredRequests;
+        std::vector<InternalData::PendingRequest> cancelledRequests;
+
+        {
+            std::lock_guard<std::mutex> lock(m_internalData->m_pendingRequestsMutex);
+            auto& pendingRequests = m_internalData->m_pendingRequests;
+
+            // All requests wait for the same time, so the queue is ordered by expiration.
+            while (!pendingRequests.empty() && (expireAll || pendingRequests.front().m_expiresAt <= now))
+            {
+                expiredRequests.push_back(std::move(pendingRequests.front()));
+                pendingRequests.pop_front();
+            }
+
+            for (auto it = pendingRequests.begin(); it != pendingRequests.end();)
+            {
+                const auto token = it->m_request.GetCancellationToken();
+
+                if (token && token->IsCancelled())
+                {
+                    cancelledRequests.push_back(std::move(*it));
+                    it = pendingRequests.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& expired : expiredRequests)
+        {
+            FailHostNotReady(expired.m_request.GetCommandId(), expired.m_onComplete);
+        }
+
+        // Cancelled requests don't wait for the host: they finish with CANCELLED before their first attempt.
+        for (auto& cancelled : cancelledRequests)
+        {
+            DispatchRequest(std::move(cancelled.m_request),
+                std::move(cancelled.m_responseCallback),
+                std::move(cancelled.m_onComplete));
         }
     }
 
@@ -193,92 +530,194 @@ namespace PTSLC_CPP
 #endif
     }
 
-    /**
-     * Internal client wrapper feature.
-     * Periodically checks the status of command execution with PING_TIMEOUT timeout.
-     * Called right after gRPC request sent to the server and terminate command execution
-     * if status of GetTaskStatus command execution is 'Failed'.
-     */
-    void CppPTSLClient::PingTaskStatus(std::string responseReceivedTaskId, std::future<void> pingCancellationToken)
+    void CppPTSLClient::PollTaskStatus(
+        const std::string& taskId, std::function<void(std::optional<TaskStatusUpdate>)> onPolled)
     {
         using namespace google::protobuf::util;
 
-        try
-        {
-            // wait 5 seconds before start pinging
-            AsyncDelay(pingCancellationToken, std::chrono::milliseconds(PING_TIMEOUT));
+        ptsl::GetTaskStatusRequestBody grpcRequestBody;
+        grpcRequestBody.set_task_id(taskId);
 
-            while (!IsCancellationRequested(pingCancellationToken))
-            {
-                ptsl::GetTaskStatusRequestBody grpcRequestBody;
-                grpcRequestBody.set_task_id(responseReceivedTaskId);
+        std::string requestBodyJson;
+        PrintJsonBody(grpcRequestBody, &requestBodyJson, CompactJsonWriteOptions());
 
-                JsonOptions jOpts = DefaultJsonWriteOptions();
+        CppPTSLRequest request { CommandId::CId_GetTaskStatus };
+        request.SetRequestBodyJson(requestBodyJson);
 
-                std::string requestBodyJSON;
-                MessageToJsonString(grpcRequestBody, &requestBodyJSON, jOpts);
+        // The monitor polls again anyway, so a failed poll isn't retried.
+        RetryPolicy retryPolicy;
+        retryPolicy.mode = RetryMode::RMode_Never;
+        request.SetRetryPolicy(retryPolicy);
+        request.SetTimeout(TASK_STATUS_POLL_TIMEOUT);
 
-                ptsl::Request grpcRequest;
-                ptsl::Response grpcResponse;
+        DispatchRequest(std::move(request),
+            nullptr,
+            [taskId, onPolled = std::move(onPolled)](const CppPTSLResponse& response, std::exception_ptr error)
+            {
+                if (error)
+                {
+                    onPolled(std::nullopt);
+                    return;
+                }
 
-                grpcRequest.mutable_header()->set_task_id("");
-                grpcRequest.mutable_header()->set_session_id("");
-                grpcRequest.mutable_header()->set_command(ptsl::CommandId::GetTaskStatus);
-                grpcRequest.mutable_header()->set_version(PTSL_VERSION_MAJOR);
-                grpcRequest.mutable_header()->set_version_minor(PTSL_VERSION_MINOR);
-                grpcRequest.mutable_header()->set_version_revision(PTSL_VERSION_REVISION);
-                grpcRequest.set_request_body_json(requestBodyJSON);
+                TaskStatusUpdate update;
+                update.taskId = taskId;
 
-                grpc::Status grpcStatus;
-                grpc::ClientContext context;
-                grpc::CompletionQueue completionQueue;
+                if (response.GetStatus() == TaskStatus::TStatus_Completed)
+                {
+                    ptsl::GetTaskStatusResponseBody responseBody;
 
-                auto asyncReader =
-                    m_internalData->m_client->AsyncSendGrpcRequest(&context, grpcRequest, &completionQueue);
-                asyncReader->Finish(&grpcResponse, &grpcStatus, (void*)true);
+                    if (ParseJsonBody(std::string { response.GetResponseBodyJsonView() },
+                            &responseBody,
+                            DefaultJsonParseOptions())
+                            .ok())
+                    {
+                        update.status = static_cast<TaskStatus>(responseBody.status());
+                        update.progress = responseBody.progress();
+                    }
+                    else
+                    {
+                        update.status = TaskStatus::TStatus_CompletedWithBadResponse;
+                    }
 
-                void* gotTag;
-                bool canReadNext;
+                    onPolled(update);
+                    return;
+                }
 
-                bool isNextResponseExist = completionQueue.Next(&gotTag, &canReadNext);
+                // A failed call says nothing about the task, unlike Pro Tools failing the command.
+                ptsl::ResponseError responseError;
 
-                if (isNextResponseExist && canReadNext && gotTag == (void*)true && grpcStatus.ok())
+                if (ParseJsonBody(
+                        std::string { response.GetResponseErrorJsonView() }, &responseError, DefaultJsonParseOptions())
+                        .ok())
                 {
-                    if (grpcResponse.header().status() == ptsl::TaskStatus::Completed)
+                    for (const auto& commandError : responseError.errors())
                     {
-                        completionQueue.Shutdown();
-                        return;
+                        if (static_cast<CommandErrorType>(commandError.command_error_type())
+                            == CommandErrorType::CEType_SDK_GrpcGeneric)
+                        {
+                            onPolled(std::nullopt);
+                            return;
+                        }
                     }
+                }
+
+                // E.g. TStatus_Failed if Pro Tools doesn't know the task.
+                update.status = response.GetStatus();
+                onPolled(update);
+            });
+    }
+
+    namespace
+    {
+        struct CommandBodyTypes
+        {
+            const google::protobuf::Descriptor* request = nullptr;
+            const google::protobuf::Descriptor* response = nullptr;
+        };
 
-                    if (grpcResponse.header().status() == ptsl::TaskStatus::CompletedWithBadResponse
-                        || grpcResponse.header().status() == ptsl::TaskStatus::FailedWithBadErrorResponse)
+        /**
+         * Returns the body messages of the command: CId_X has XRequestBody and XResponseBody, if PTSL.proto defines
+         * them. The generated CppPTSLCommandTraits.h follows the same rule.
+         */
+        const CommandBodyTypes& FindCommandBodyTypes(CommandId commandId)
+        {
+            static const std::vector<CommandBodyTypes> bodyTypes = []
+            {
+                const google::protobuf::EnumDescriptor* commandIds = ptsl::CommandId_descriptor();
+                const google::protobuf::FileDescriptor* file = commandIds->file();
+                const std::string prefix = "CId_";
+                std::vector<CommandBodyTypes> result;
+                std::set<int32_t> numbers;
+
+                for (int32_t i = 0; i < commandIds->value_count(); ++i)
+                {
+                    const std::string& name = commandIds->value(i)->name();
+                    const int32_t number = commandIds->value(i)->number();
+
+                    // the other names of a number are deprecated aliases, like in the generated traits
+                    if (number < 0 || name.compare(0, prefix.size(), prefix) != 0 || !numbers.insert(number).second)
                     {
-                        completionQueue.Shutdown();
-                        static const std::string warningMessage(
-                            "PingTaskStatus canceled. GetTaskStatus returned incorrect response JSON. Status: "
-                            + std::to_string(grpcResponse.header().status()));
-                        SafeLogger::SyncPrint(warningMessage);
-                        return;
+                        continue;
                     }
 
-                    if (grpcResponse.header().status() == ptsl::TaskStatus::Failed)
+                    const auto index = static_cast<size_t>(number);
+                    const std::string command = name.substr(prefix.size());
+
+                    if (index >= result.size())
                     {
-                        completionQueue.Shutdown();
-                        static const std::string errorMessage(
-                            "PingTaskStatus canceled. GetTaskStatus returned status Failed. Could not find a task with task ID: "
-                            + responseReceivedTaskId);
-                        throw std::runtime_error(errorMessage.c_str());
+                        result.resize(index + 1);
                     }
+
+                    result[index].request = file->FindMessageTypeByName(command + "RequestBody");
+                    result[index].response = file->FindMessageTypeByName(command + "ResponseBody");
                 }
 
-                completionQueue.Shutdown();
-                AsyncDelay(pingCancellationToken, std::chrono::milliseconds(PING_TIMEOUT));
-            }
+                return result;
+            }();
+            static const CommandBodyTypes noBodies;
+
+            const auto index = static_cast<size_t>(commandId);
+            return index < bodyTypes.size() ? bodyTypes[index] : noBodies;
         }
-        catch (const TaskCancelledException&)
+    } // namespace
+
+    std::optional<std::string> CppPTSLClient::RequestBodyToJson(CommandId commandId, const std::string& binaryBody)
+    {
+        const google::protobuf::Descriptor* bodyType = FindCommandBodyTypes(commandId).request;
+
+        if (!bodyType)
         {
-            return;
+            // google::protobuf::Empty, the command sends no body
+            return binaryBody.empty() ? std::make_optional<std::string>() : std::nullopt;
+        }
+
+        std::unique_ptr<google::protobuf::Message> body(
+            google::protobuf::MessageFactory::generated_factory()->GetPrototype(bodyType)->New());
+        std::string requestBodyJson;
+
+        if (!body->ParseFromString(binaryBody)
+            || !PrintJsonBody(*body, &requestBodyJson, CompactJsonWriteOptions()).ok())
+        {
+            return std::nullopt;
+        }
+
+        return requestBodyJson;
+    }
+
+    std::optional<std::string> CppPTSLClient::ResponseBodyToBinary(CommandId commandId, const CppPTSLResponse& response)
+    {
+        const google::protobuf::Descriptor* bodyType = FindCommandBodyTypes(commandId).response;
+        const std::string_view responseBodyJson = response.GetResponseBodyJsonView();
+
+        // google::protobuf::Empty, or a response without a body, e.g. of a queued task
+        if (!bodyType || responseBodyJson.find_first_not_of(" \t\r\n") == std::string_view::npos)
+        {
+            return std::make_optional<std::string>();
+        }
+
+        std::unique_ptr<google::protobuf::Message> body(
+            google::protobuf::MessageFactory::generated_factory()->GetPrototype(bodyType)->New());
+        std::string binaryBody;
+
+        if (!ParseJsonBody(std::string { responseBodyJson }, body.get(), DefaultJsonParseOptions()).ok()
+            || !body->SerializeToString(&binaryBody))
+        {
+            return std::nullopt;
         }
+
+        return binaryBody;
+    }
+
+    uint64_t CppPTSLClient::WatchTask(
+        const std::string& taskId, std::function<void(const TaskStatusUpdate&)> onStatusChanged)
+    {
+        return m_internalData->m_taskMonitor->Watch(taskId, std::move(onStatusChanged));
+    }
+
+    void CppPTSLClient::StopWatchingTask(uint64_t watchId)
+    {
+        m_internalData->m_taskMonitor->Unwatch(watchId);
     }
 
     std::shared_ptr<CommandResponse> CppPTSLClient::SendErrorResponse(CommandId commandType)
@@ -316,7 +755,7 @@ namespace PTSLC_CPP
         JsonOptions jOpts = DefaultJsonWriteOptions();
         std::string errorJson;
 
-        if (MessageToJsonString(responseError, &errorJson, jOpts).ok())
+        if (PrintJsonBody(responseError, &errorJson, jOpts).ok())
         {
             response.SetResponseErrorJson(errorJson);
         }
@@ -336,190 +775,911 @@ namespace PTSLC_CPP
             "[Error]: Pro Tools is not available yet.");
     }
 
-    std::string CppPTSLClient::LookForSessionId(const std::string& responseBodyJson)
+    std::string CppPTSLClient::LookForSessionId(const CppPTSLResponse& response)
     {
-        const std::string sessionIdKey = "session_id";
-        std::string errorMessage {};
-
-        // Quickest pre-check:
-        if (responseBodyJson.empty() || responseBodyJson.find(sessionIdKey) == std::string::npos)
-        {
-            errorMessage = "Session ID not found in response body.";
-        }
-
-        try
-        {
-            auto parsedJson = json::parse(responseBodyJson);
-
-            if (parsedJson.contains(sessionIdKey) && parsedJson[sessionIdKey].is_string())
-            {
-                return parsedJson[sessionIdKey].get<std::string>();
-            }
-            else
-            {
-                errorMessage = "Session ID not found in response body.";
-            }
-        }
-        catch (json::exception& e)
+        // Only the session ID is needed, the rest of the body isn't parsed.
+        if (auto sessionId = response.Field("session_id").AsString())
         {
-            errorMessage = std::string { "Exception while parsing session_id from response body: " } + e.what();
+            return *sessionId;
         }
 
-        throw PTSLException(errorMessage + " Response body: " + responseBodyJson);
-
-        return std::string();
+        throw PTSLException(
+            "Session ID not found in response body. Response body: " + std::string { response.GetResponseBodyJsonView() });
     }
 
     std::future<CppPTSLResponse> CppPTSLClient::SendRequest(CppPTSLRequest request, std::function<void(const CppPTSLResponse&)> responseCallback)
     {
-        auto context = std::make_shared<InternalData::RpcContext>();
-
-        const auto commandId = request.GetCommandId();
-
-        {
-            std::lock_guard<std::mutex> lock(m_internalData->m_rpcContextsMutex);
-            m_internalData->m_rpcContexts.push_back(context);
-        }
-
-        // Passing a weak pointer to the RPC call to detect when the RPC is finished.
+        auto promise = std::make_shared<std::promise<CppPTSLResponse>>();
+        std::future<CppPTSLResponse> fResponse = promise->get_future();
 
-        auto processRequest = [this, &grpcContext = context->m_grpcContext, request = std::move(request), responseCallback = std::move(responseCallback)]() -> CppPTSLResponse
-        {
-            // allows HostReadyCheck command to check if the Pro Tools application is fully loaded
-            // and ready to execute all other PTSL commands
-            if (!m_isHostReady && request.GetCommandId() != CommandType::HostReadyCheck)
+        StartRequest(std::move(request), std::move(responseCallback),
+            [promise](const CppPTSLResponse& response, std::exception_ptr error)
             {
-                auto notReadyResponse = this->SendHostNotReadyResponse(request.GetCommandId());
-                return notReadyResponse;
-            }
-
-            ptsl::Request grpcRequest;
-            ptsl::Response grpcResponse;
-            CppPTSLResponse response { request.GetCommandId() };
-
-            grpcRequest.mutable_header()->set_command(static_cast<ptsl::CommandId>(request.GetCommandId()));
-            grpcRequest.mutable_header()->set_session_id(
-                request.GetSessionId().empty() ? GetSessionId() : request.GetSessionId());
-            grpcRequest.mutable_header()->set_version(request.GetVersion() == 0 ? PTSL_VERSION_MAJOR : request.GetVersion());
-            grpcRequest.mutable_header()->set_version_minor(request.GetVersionMinor() == 0 ? PTSL_VERSION_MINOR : request.GetVersionMinor());
-            grpcRequest.mutable_header()->set_version_revision(request.GetVersionRevision() == 0 ? PTSL_VERSION_REVISION : request.GetVersionRevision());
-            grpcRequest.mutable_header()->set_versioned_request_header_json(request.GetVersionedRequestHeaderJson());
+                if (error)
+                {
+                    promise->set_exception(error);
+                }
+                else
+                {
+                    promise->set_value(response);
+                }
+            });
 
-            grpcRequest.set_request_body_json(request.GetRequestBodyJson());
+        return fResponse;
+    }
 
-            auto reader = m_internalData->m_client->SendGrpcStreamingRequest(&grpcContext, grpcRequest);
+    void CppPTSLClient::SendRequest(CppPTSLRequest request,
+        std::function<void(const CppPTSLResponse&)> responseCallback,
+        std::function<void(const CppPTSLResponse&)> completionCallback)
+    {
+        const auto commandId = request.GetCommandId();
 
-            while (reader->Read(&grpcResponse))
+        StartRequest(std::move(request), std::move(responseCallback),
+            [this, commandId, completionCallback = std::move(completionCallback)](const CppPTSLResponse& response, std::exception_ptr error)
             {
-                response.SetCommandId(static_cast<CommandId>(grpcResponse.header().command()));
-                response.SetTaskId(grpcResponse.header().task_id());
-                response.SetStatus(static_cast<CommandStatusType>(grpcResponse.header().status()));
-                response.SetVersion(grpcResponse.header().version());
-                response.SetVersionMinor(grpcResponse.header().version_minor());
-                response.SetVersionRevision(grpcResponse.header().version_revision());
-                response.SetProgress(grpcResponse.header().progress());
-                response.SetVersionedResponseHeaderJson(grpcResponse.header().versioned_response_header_json());
-                response.SetResponseBodyJson(grpcResponse.response_body_json());
-                response.SetResponseErrorJson(grpcResponse.response_error_json());
-
-                if (responseCallback)
+                if (!completionCallback)
                 {
-                    responseCallback(response);
+                    return;
                 }
-            }
-
-            grpc::Status grpcStatus = reader->Finish();
 
-            if (grpcStatus.error_code())
+                try
+                {
+                    if (!error)
+                    {
+                        completionCallback(response);
+                        return;
+                    }
+
+                    std::string errorMessage = "Unknown exception while processing the response.";
+                    try
+                    {
+                        std::rethrow_exception(error);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        errorMessage = std::string { "Exception while processing the response: " } + e.what();
+                    }
+                    catch (...)
+                    {
+                    }
+
+                    completionCallback(SendErrorResponse(commandId, CommandErrorType::CEType_SDK_Error, errorMessage));
+                }
+                catch (const std::exception& e)
+                {
+                    // There is nobody to rethrow to on the service thread.
+                    SafeLogger::SyncPrint(std::string { "Exception in the request completion callback: " } + e.what() + "\n");
+                }
+                catch (...)
+                {
+                    SafeLogger::SyncPrint("Unknown exception in the request completion callback.\n");
+                }
+            });
+    }
+
+    void CppPTSLClient::StartRequest(CppPTSLRequest request,
+        std::function<void(const CppPTSLResponse&)> responseCallback,
+        std::function<void(const CppPTSLResponse&, std::exception_ptr)> onComplete)
+    {
+        const auto commandId = request.GetCommandId();
+        const auto cancellationToken = request.GetCancellationToken();
+
+        // A cancelled request is sent anyway, so that it finishes with CANCELLED like any other.
+        if (IsCachedRequest(request, m_internalData->m_responseCache.get())
+            && !(cancellationToken && cancellationToken->IsCancelled()))
+        {
+            auto cachedResponse = m_internalData->m_responseCache->Find(
+                MakeRequestKey(request, m_internalData->m_sessionId.Load()));
+
+            if (cachedResponse)
+            {
+                // Finished like a sent request, so that OnResponseReceived gets the response as well.
+                auto state = std::make_shared<RequestState>();
+
+                state->m_commandId = commandId;
+                state->m_response = std::move(*cachedResponse);
+                state->m_hasResponses = true;
+                state->m_onComplete = std::move(onComplete);
+
+                if (responseCallback)
+                {
+                    try
+                    {
+                        responseCallback(state->m_response);
+                    }
+                    catch (...)
+                    {
+                        state->m_callbackError = std::current_exception();
+                    }
+                }
+
+                FinishRequest(std::move(state));
+                return;
+            }
+        }
+
+        // allows HostReadyCheck command to check if the Pro Tools application is fully loaded
+        // and ready to execute all other PTSL commands
+        if (!m_isHostReady && commandId != CommandType::HostReadyCheck)
+        {
+            std::unique_lock<std::mutex> lock(m_internalData->m_pendingRequestsMutex);
+
+            // Re-checked under the lock: SetHostReady sets the flag first and then takes the queue under this lock.
+            if (!m_isHostReady)
+            {
+                // Until the initialization is finished the request waits for it. Afterwards it only waits
+                // if the connection watcher, which expires the waiting requests, is running.
+                const bool canWait = !m_internalData->m_isInitialized
+                    || (m_clientConfig.hostReadyWaitTimeout.count() > 0 && m_internalData->m_connectionWatcher);
+
+                if (!canWait)
+                {
+                    lock.unlock();
+                    FailHostNotReady(commandId, onComplete);
+                    return;
+                }
+
+                m_internalData->m_pendingRequests.push_back({ std::move(request),
+                    std::move(responseCallback),
+                    std::move(onComplete),
+                    std::chrono::steady_clock::now() + m_clientConfig.hostReadyWaitTimeout });
+                return;
+            }
+        }
+
+        // Backpressure for the producers; a service thread must never wait for the requests it completes.
+        if (m_clientConfig.blockOnAdmission && m_internalData->m_admission && !IsAdmissionExempt(commandId)
+            && !m_internalData->m_asyncEngine->IsPollerThread())
+        {
+            m_internalData->m_admission->WaitForCapacity(GetCommandClass(commandId, IsStreamingRequest(request)));
+        }
+
+        DispatchRequest(std::move(request), std::move(responseCallback), std::move(onComplete));
+    }
+
+    void CppPTSLClient::DispatchRequest(CppPTSLRequest request,
+        std::function<void(const CppPTSLResponse&)> responseCallback,
+        std::function<void(const CppPTSLResponse&, std::exception_ptr)> onComplete)
+    {
+        const auto commandId = request.GetCommandId();
+
+        // An identical request in flight delivers its response to this one as well.
+        if (IsSingleFlightRequest(request, m_clientConfig))
+        {
+            SingleFlightKey key = MakeSingleFlightKey(request, m_internalData->m_sessionId.Load());
+
+            auto call = std::make_shared<InternalData::SingleFlightCall>();
+
+            {
+                std::lock_guard<std::mutex> lock(m_internalData->m_singleFlightMutex);
+
+                auto inserted = m_internalData->m_singleFlightCalls.emplace(key, call);
+
+                if (!inserted.second)
+                {
+                    inserted.first->second->m_followers.push_back({ std::move(responseCallback), std::move(onComplete) });
+                    return;
+                }
+            }
+
+            // The exception of the leader's callback is its own; it only tells the followers to send their requests.
+            if (responseCallback)
+            {
+                responseCallback = [call, leaderCallback = std::move(responseCallback)](const CppPTSLResponse& response)
+                {
+                    try
+                    {
+                        leaderCallback(response);
+                    }
+                    catch (...)
+                    {
+                        call->m_isLeaderCallbackFailed = true;
+                        throw;
+                    }
+                };
+            }
+
+            onComplete = [this, key = std::move(key), call, request, leaderOnComplete = std::move(onComplete)](
+                             const CppPTSLResponse& response, std::exception_ptr error)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_internalData->m_singleFlightMutex);
+                    m_internalData->m_singleFlightCalls.erase(key);
+                }
+
+                // Nobody can join anymore, so the followers are read without the lock.
+                leaderOnComplete(response, error);
+
+                if (call->m_isLeaderCallbackFailed)
+                {
+                    // The first of them leads a new call, the others join it.
+                    for (auto& follower : call->m_followers)
+                    {
+                        DispatchRequest(
+                            request, std::move(follower.m_responseCallback), std::move(follower.m_onComplete));
+                    }
+
+                    return;
+                }
+
+                for (auto& follower : call->m_followers)
+                {
+                    std::exception_ptr followerError = error;
+
+                    if (!followerError && follower.m_responseCallback)
+                    {
+                        try
+                        {
+                            follower.m_responseCallback(response);
+                        }
+                        catch (...)
+                        {
+                            followerError = std::current_exception();
+                        }
+                    }
+
+                    follower.m_onComplete(response, followerError);
+                }
+            };
+        }
+
+        // The ticket is taken before sending, so a change finishing in the meantime keeps the response out.
+        if (IsCachedRequest(request, m_internalData->m_responseCache.get()))
+        {
+            ResponseCache* cache = m_internalData->m_responseCache.get();
+
+            onComplete = [cache,
+                             key = MakeRequestKey(request, m_internalData->m_sessionId.Load()),
+                             ticket = cache->TakeTicket(commandId),
+                             onComplete = std::move(onComplete)](const CppPTSLResponse& response, std::exception_ptr error)
+            {
+                if (!error && response.GetStatus() == CommandStatusType::TStatus_Completed
+                    && response.GetResponseErrorJsonView().empty())
+                {
+                    cache->Store(key, response, ticket);
+                }
+
+                onComplete(response, error);
+            };
+        }
+
+        auto state = std::make_shared<RequestState>();
+
+        state->m_commandId = commandId;
+        state->m_response = CppPTSLResponse { commandId };
+        state->m_responseCallback = std::move(responseCallback);
+        state->m_onComplete = std::move(onComplete);
+        state->m_isStreaming = IsStreamingRequest(request);
+        state->m_commandClass = GetCommandClass(commandId, state->m_isStreaming);
+        state->m_priority = request.GetPriority();
+        if (request.GetTimeout().count() > 0)
+        {
+            state->m_deadline = std::chrono::system_clock::now() + request.GetTimeout();
+        }
+
+        state->m_retryPolicy = request.GetRetryPolicy();
+        state->m_isRetryable = state->m_retryPolicy.mode == RetryMode::RMode_Always
+            || (state->m_retryPolicy.mode == RetryMode::RMode_Auto && IsReadOnlyCommand(commandId));
+
+        // Both messages live as long as the request; the arena goes back to the pool when the state is destroyed.
+        state->m_arena = m_internalData->m_arenaPool->Acquire();
+        state->m_grpcRequest = google::protobuf::Arena::CreateMessage<ptsl::Request>(state->m_arena.get());
+        state->m_grpcResponse = google::protobuf::Arena::CreateMessage<ptsl::Response>(state->m_arena.get());
+
+        ptsl::Request& grpcRequest = *state->m_grpcRequest;
+        ptsl::RequestHeader& header = *grpcRequest.mutable_header();
+
+        header = m_internalData->m_requestHeaderPrototype;
+        header.set_command(static_cast<ptsl::CommandId>(commandId));
+
+        std::string sessionId = request.GetSessionId();
+        header.set_session_id(sessionId.empty() ? m_internalData->m_sessionId.Load() : std::move(sessionId));
+
+        if (request.GetVersion() != 0)
+        {
+            header.set_version(request.GetVersion());
+        }
+
+        if (request.GetVersionMinor() != 0)
+        {
+            header.set_version_minor(request.GetVersionMinor());
+        }
+
+        if (request.GetVersionRevision() != 0)
+        {
+            header.set_version_revision(request.GetVersionRevision());
+        }
+
+        header.set_versioned_request_header_json(request.GetVersionedRequestHeaderJson());
+
+        grpcRequest.set_request_body_json(request.GetRequestBodyJson());
+
+        // Only the calls on the client's own session can be moved to the restored one.
+        if (m_clientConfig.autoReconnect && commandId == CommandId::CId_PollEvents && request.GetSessionId().empty())
+        {
+            std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+            state->m_isResumable = true;
+            state->m_connectionGeneration = m_internalData->m_connectionGeneration;
+        }
+
+        state->m_rpcContext = std::make_shared<InternalData::RpcContext>();
+        m_internalData->m_rpcContexts.Add(state->m_rpcContext);
+
+        // Requests registered after the destructor cancelled all active ones must not start at all.
+        if (m_internalData->m_isShuttingDown)
+        {
+            state->m_rpcContext->Cancel();
+        }
+
+        state->m_cancellationToken = request.GetCancellationToken();
+
+        if (state->m_cancellationToken)
+        {
+            // Runs right away if the token is already cancelled, so the first attempt doesn't start.
+            state->m_cancellationCallbackId = state->m_cancellationToken->Subscribe(
+                [weakContext = std::weak_ptr<InternalData::RpcContext>(state->m_rpcContext)]()
+                {
+                    if (auto context = weakContext.lock())
+                    {
+                        context->Cancel();
+                    }
+                });
+        }
+
+        AdmitRequest(std::move(state));
+    }
+
+    void CppPTSLClient::AdmitRequest(std::shared_ptr<RequestState> state)
+    {
+        AdmissionController* admission = m_internalData->m_admission.get();
+
+        if (!admission || IsAdmissionExempt(state->m_commandId) || admission->TryAcquire(state->m_commandClass))
+        {
+            state->m_isAdmitted = admission != nullptr && !IsAdmissionExempt(state->m_commandId);
+            state->m_admittedAt = std::chrono::steady_clock::now();
+            StartAttempt(std::move(state));
+            return;
+        }
+
+        // The request waits on an alarm, so a cancellation or the request's timeout ends the wait like a backoff.
+        auto* alarm = new AsyncAlarm(
+            [this, state](bool)
+            {
+                state->m_rpcContext->EndBackoff();
+
+                state->m_isAdmitted = !m_internalData->m_admission->Withdraw(state->m_admissionWaiter);
+                state->m_admittedAt = std::chrono::steady_clock::now();
+
+                if (state->m_rpcContext->IsCancelled())
+                {
+                    state->m_grpcStatus = grpc::Status { grpc::StatusCode::CANCELLED, "Request cancelled" };
+                    FinishRequest(state);
+                }
+                else if (!state->m_isAdmitted)
+                {
+                    state->m_grpcStatus =
+                        grpc::Status { grpc::StatusCode::DEADLINE_EXCEEDED, "Request timed out waiting for admission" };
+                    FinishRequest(state);
+                }
+                else
+                {
+                    StartAttempt(state);
+                }
+            });
+
+        state->m_admissionWaiter = AdmissionController::CreateWaiter(state->m_commandClass,
+            state->m_priority,
+            [weakContext = std::weak_ptr<InternalData::RpcContext>(state->m_rpcContext)]()
+            {
+                if (auto context = weakContext.lock())
+                {
+                    context->WakeUp();
+                }
+            });
+
+        if (!state->m_rpcContext->BeginBackoff(
+                *alarm, m_internalData->m_asyncEngine->NextCompletionQueue(), state->m_deadline))
+        {
+            delete alarm;
+            state->m_grpcStatus = grpc::Status { grpc::StatusCode::CANCELLED, "Request cancelled" };
+            FinishRequest(std::move(state));
+            return;
+        }
+
+        // Queued only after the alarm is set, so the admission can't come before there is an alarm to wake up.
+        admission->Enqueue(state->m_admissionWaiter);
+    }
+
+    void CppPTSLClient::StartAttempt(std::shared_ptr<RequestState> state)
+    {
+        ++state->m_attempt;
+
+        auto grpcContext = std::make_shared<grpc::ClientContext>();
+        auto deadline = state->m_deadline;
+
+        if (state->m_retryPolicy.attemptTimeout.count() > 0)
+        {
+            deadline = std::min(deadline, std::chrono::system_clock::now() + state->m_retryPolicy.attemptTimeout);
+        }
+
+        if (deadline != std::chrono::system_clock::time_point::max())
+        {
+            grpcContext->set_deadline(deadline);
+        }
+
+        if (!state->m_rpcContext->BeginAttempt(grpcContext))
+        {
+            state->m_grpcStatus = grpc::Status { grpc::StatusCode::CANCELLED, "Request cancelled" };
+            FinishRequest(std::move(state));
+            return;
+        }
+
+        // Only event streams can make the cached responses stale.
+        ResponseCache* responseCache =
+            state->m_commandId == CommandId::CId_PollEvents ? m_internalData->m_responseCache.get() : nullptr;
+
+        auto onRead = [state, grpcContext = grpcContext.get(), responseCache](ptsl::Response& grpcResponse)
+        {
+            if (state->m_callbackError)
+            {
+                return;
+            }
+
+            CppPTSLResponse& response = state->m_response;
+            state->m_hasResponses = true;
+
+            response.SetCommandId(static_cast<CommandId>(grpcResponse.header().command()));
+            response.SetTaskId(grpcResponse.header().task_id());
+            response.SetStatus(static_cast<CommandStatusType>(grpcResponse.header().status()));
+            response.SetVersion(grpcResponse.header().version());
+            response.SetVersionMinor(grpcResponse.header().version_minor());
+            response.SetVersionRevision(grpcResponse.header().version_revision());
+            response.SetProgress(grpcResponse.header().progress());
+            response.SetVersionedResponseHeaderJson(grpcResponse.header().versioned_response_header_json());
+            // The message is refilled by the next read, so its strings can be moved out.
+            response.SetResponseBodyJson(std::move(*grpcResponse.mutable_response_body_json()));
+            response.SetResponseErrorJson(std::move(*grpcResponse.mutable_response_error_json()));
+
+            if (responseCache && IsSessionChangeEvent(response))
+            {
+                responseCache->Clear();
+            }
+
+            if (state->m_responseCallback)
             {
-                return SendErrorResponse(request.GetCommandId(),
+                try
+                {
+                    state->m_responseCallback(response);
+                }
+                catch (...)
+                {
+                    // Stop the call; the exception is reported when the call finishes.
+                    state->m_callbackError = std::current_exception();
+                    grpcContext->TryCancel();
+                }
+            }
+        };
+
+        // The lease keeps the channel marked as busy until the call and its handlers are destroyed.
+        auto stub = m_internalData->m_channelPool->Acquire(state->m_isStreaming);
+
+        auto onFinish = [this, state, stub](const grpc::Status& grpcStatus)
+        {
+            state->m_grpcStatus = grpcStatus;
+            OnAttemptFinished(state);
+        };
+
+        grpc::CompletionQueue& completionQueue = m_internalData->m_asyncEngine->NextCompletionQueue();
+
+        if (state->m_isStreaming)
+        {
+            auto* call = new AsyncStreamingCall(
+                std::move(grpcContext), state->m_grpcResponse, std::move(onRead), std::move(onFinish));
+            call->Start(*stub, *state->m_grpcRequest, completionQueue);
+        }
+        else
+        {
+            auto* call = new AsyncUnaryCall(
+                std::move(grpcContext), state->m_grpcResponse, std::move(onRead), std::move(onFinish));
+            call->Start(*stub, *state->m_grpcRequest, completionQueue);
+        }
+    }
+
+    void CppPTSLClient::OnAttemptFinished(std::shared_ptr<RequestState> state)
+    {
+        const grpc::StatusCode errorCode = state->m_grpcStatus.error_code();
+
+        if (errorCode == grpc::StatusCode::OK)
+        {
+            m_internalData->m_retryBudget->OnSuccess();
+            FinishRequest(std::move(state));
+            return;
+        }
+
+        // A server going down cancels the event stream or breaks the connection.
+        if (state->m_isResumable && !state->m_callbackError && !state->m_rpcContext->IsCancelled()
+            && (errorCode == grpc::StatusCode::UNAVAILABLE || errorCode == grpc::StatusCode::CANCELLED))
+        {
+            SuspendEventStream(std::move(state));
+            return;
+        }
+
+        const bool isTransient =
+            errorCode == grpc::StatusCode::UNAVAILABLE || errorCode == grpc::StatusCode::DEADLINE_EXCEEDED;
+
+        // The budget is charged for every transient failure, even if the request itself may not be retried.
+        const bool isRetryAllowed = isTransient && m_internalData->m_retryBudget->OnFailure();
+
+        // Responses already delivered to the callback can't be taken back, so such requests are never repeated.
+        if (!isRetryAllowed || !state->m_isRetryable || state->m_hasResponses || state->m_callbackError
+            || state->m_attempt >= state->m_retryPolicy.maxAttempts)
+        {
+            FinishRequest(std::move(state));
+            return;
+        }
+
+        const auto retryAt =
+            std::chrono::system_clock::now() + ComputeRetryBackoff(state->m_retryPolicy, state->m_attempt);
+
+        // A retry that can't start before the deadline of the request would only fail with DEADLINE_EXCEEDED.
+        if (retryAt >= state->m_deadline)
+        {
+            FinishRequest(std::move(state));
+            return;
+        }
+
+        auto* alarm = new AsyncAlarm(
+            [this, state](bool isExpired)
+            {
+                state->m_rpcContext->EndBackoff();
+
+                if (isExpired)
+                {
+                    StartAttempt(state);
+                }
+                else
+                {
+                    state->m_grpcStatus = grpc::Status { grpc::StatusCode::CANCELLED, "Request cancelled" };
+                    FinishRequest(state);
+                }
+            });
+
+        if (!state->m_rpcContext->BeginBackoff(*alarm, m_internalData->m_asyncEngine->NextCompletionQueue(), retryAt))
+        {
+            delete alarm;
+            FinishRequest(std::move(state));
+        }
+    }
+
+    void CppPTSLClient::FinishRequest(std::shared_ptr<RequestState> state)
+    {
+        const CommandId commandId = state->m_commandId;
+
+        auto processStatus = [&]() -> CppPTSLResponse
+        {
+            if (state->m_grpcStatus.error_code())
+            {
+                return SendErrorResponse(commandId,
                     CommandErrorType::CEType_SDK_GrpcGeneric,
-                    "PTSL request failed with grpc error code = " + std::to_string(grpcStatus.error_code()));
+                    "PTSL request failed with grpc error code = " + std::to_string(state->m_grpcStatus.error_code()));
             }
 
-            if (request.GetCommandId() == CommandId::RegisterConnection)
+            if (commandId == CommandId::RegisterConnection)
             {
                 try
                 {
-                    this->SetSessionId(this->LookForSessionId(grpcResponse.response_body_json()));
+                    this->SetSessionId(this->LookForSessionId(state->m_response));
                 }
                 catch (const PTSLException& e)
                 {
-                    return SendErrorResponse(
-                        request.GetCommandId(), CommandErrorType::CEType_SDK_SessionIdParseError, e.what());
+                    return SendErrorResponse(commandId, CommandErrorType::CEType_SDK_SessionIdParseError, e.what());
                 }
             }
 
+            // A response from the cache has no request message, and its command is read-only anyway.
+            if (m_clientConfig.autoReconnect && state->m_grpcRequest
+                && state->m_response.GetStatus() == CommandStatusType::TStatus_Completed)
+            {
+                RecordConnectionSetup(*state);
+            }
+
             if (this->OnResponseReceived)
             {
-                this->OnResponseReceived(std::make_shared<CppPTSLResponse>(response));
+                this->OnResponseReceived(std::make_shared<CppPTSLResponse>(state->m_response));
             }
 
-            return response;
+            // The request is finished; leaving the body to the caller alone lets it be moved out later.
+            return std::move(state->m_response);
         };
 
-        auto processRequestWithCleanup = [this, commandId, processRequest = std::move(processRequest), weakContext = std::weak_ptr<InternalData::RpcContext>{context}]()
+        CppPTSLResponse response { commandId };
+        std::exception_ptr error = state->m_callbackError;
+
+        if (!error)
         {
-            auto context = weakContext.lock();
-            if (!context)
+            try
             {
-                // The context has been cancelled or destroyed before the request was sent.
-                CppPTSLResponse response{ commandId };
-                response.SetStatus(CommandStatusType::Failed);
-                return response;
+                response = processStatus();
             }
-
-            CppPTSLResponse response = processRequest();
-
-            // Remove the context from the list of active contexts.
+            catch (...)
             {
-                std::lock_guard<std::mutex> lock(m_internalData->m_rpcContextsMutex);
-                m_internalData->m_rpcContexts.remove(context);
+                error = std::current_exception();
             }
+        }
 
-            return response;
-        };
+        if (state->m_cancellationToken)
+        {
+            state->m_cancellationToken->Unsubscribe(state->m_cancellationCallbackId);
+        }
 
-        std::future<CppPTSLResponse> fResponse = std::async(std::launch::async, processRequestWithCleanup);
+        // Even a failed command may have changed something.
+        EvictStaleResponses(commandId);
 
-        return fResponse;
+        if (state->m_isAdmitted)
+        {
+            const grpc::StatusCode errorCode = state->m_grpcStatus.error_code();
+            const bool isOverloaded = errorCode == grpc::StatusCode::DEADLINE_EXCEEDED
+                || errorCode == grpc::StatusCode::RESOURCE_EXHAUSTED || errorCode == grpc::StatusCode::UNAVAILABLE;
+
+            state->m_isAdmitted = false;
+            m_internalData->m_admission->Release(
+                state->m_commandClass, std::chrono::steady_clock::now() - state->m_admittedAt, isOverloaded);
+        }
+
+        state->m_onComplete(response, error);
+    }
+
+    void CppPTSLClient::EvictStaleResponses(CommandId commandId)
+    {
+        if (m_internalData->m_responseCache && !IsReadOnlyCommand(commandId))
+        {
+            m_internalData->m_responseCache->OnCommandFinished(commandId);
+        }
     }
 
     void CppPTSLClient::CancelRequests(bool waitForCancel)
     {
-        std::list<std::shared_ptr<InternalData::RpcContext>> contexts;
+        // Cancel all grpc requests and pending retries.
+        m_internalData->m_rpcContexts.CancelAll(waitForCancel);
+    }
+
+    void CppPTSLClient::RecordConnectionSetup(const RequestState& state)
+    {
+        using namespace google::protobuf::util;
+
+        const std::string& requestBodyJson = state.m_grpcRequest->request_body_json();
+        JsonParseOptions jOpts = DefaultJsonParseOptions();
+
+        std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+
+        if (state.m_commandId == CommandId::CId_RegisterConnection)
+        {
+            // The subscriptions belong to the previous session.
+            m_internalData->m_registrationBodyJson = requestBodyJson;
+            m_internalData->m_eventSubscriptions.clear();
+        }
+        else if (state.m_commandId == CommandId::CId_SubscribeToEvents)
+        {
+            ptsl::SubscribeToEventsRequestBody requestBody;
+
+            if (ParseJsonBody(requestBodyJson, &requestBody, jOpts).ok())
+            {
+                for (const auto& event : requestBody.events())
+                {
+                    m_internalData->m_eventSubscriptions.emplace(event.event_id(), event.event_data_json());
+                }
+            }
+        }
+        else if (state.m_commandId == CommandId::CId_UnsubscribeFromEvents)
+        {
+            ptsl::UnsubscribeFromEventsRequestBody requestBody;
+
+            if (ParseJsonBody(requestBodyJson, &requestBody, jOpts).ok())
+            {
+                for (const auto& event : requestBody.events())
+                {
+                    m_internalData->m_eventSubscriptions.erase({ event.event_id(), event.event_data_json() });
+                }
+            }
+        }
+    }
+
+    bool CppPTSLClient::RestoreConnectionSetup()
+    {
+        using namespace google::protobuf::util;
+
+        std::optional<std::string> registrationBodyJson;
+        std::set<std::pair<int32_t, std::string>> eventSubscriptions;
+
+        {
+            std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+
+            if (!m_internalData->m_isConnectionLost)
+            {
+                return true;
+            }
+
+            registrationBodyJson = m_internalData->m_registrationBodyJson;
+            eventSubscriptions = m_internalData->m_eventSubscriptions;
+        }
+
+        // Sent directly: the other requests keep waiting for the host until the restoration is finished.
+        auto sendSetupRequest = [this](CommandId commandId, const std::string& requestBodyJson)
+        {
+            CppPTSLRequest request { commandId, requestBodyJson };
+            request.SetTimeout(CONNECTION_SETUP_TIMEOUT);
+
+            std::promise<CppPTSLResponse> promise;
+            auto future = promise.get_future();
+
+            DispatchRequest(std::move(request),
+                nullptr,
+                [&promise](const CppPTSLResponse& response, std::exception_ptr error)
+                {
+                    if (error)
+                    {
+                        promise.set_exception(error);
+                    }
+                    else
+                    {
+                        promise.set_value(response);
+                    }
+                });
+
+            try
+            {
+                return future.get().GetStatus() == CommandStatusType::TStatus_Completed;
+            }
+            catch (...)
+            {
+                return false;
+            }
+        };
+
+        // Without a registration made by this client only the event streams are resumed, e.g. on a session id
+        // set with SetSessionId.
+        if (registrationBodyJson)
+        {
+            if (!sendSetupRequest(CommandId::CId_RegisterConnection, *registrationBodyJson))
+            {
+                return false;
+            }
+
+            if (!eventSubscriptions.empty())
+            {
+                ptsl::SubscribeToEventsRequestBody requestBody;
+
+                for (const auto& subscription : eventSubscriptions)
+                {
+                    auto* event = requestBody.add_events();
+                    event->set_event_id(static_cast<ptsl::EventId>(subscription.first));
+                    event->set_event_data_json(subscription.second);
+                }
+
+                std::string requestBodyJson;
+                JsonOptions jOpts = CompactJsonWriteOptions();
+
+                if (!PrintJsonBody(requestBody, &requestBodyJson, jOpts).ok()
+                    || !sendSetupRequest(CommandId::CId_SubscribeToEvents, requestBodyJson))
+                {
+                    // The new registration has cleared them; keep them for the next attempt.
+                    std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+                    m_internalData->m_eventSubscriptions.insert(eventSubscriptions.begin(), eventSubscriptions.end());
+                    return false;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+
+        m_internalData->m_isConnectionLost = false;
+        ++m_internalData->m_connectionGeneration;
+
+        for (const auto& suspendedStream : m_internalData->m_suspendedEventStreams)
         {
-            std::lock_guard<std::mutex> lock(m_internalData->m_rpcContextsMutex);
-            contexts = m_internalData->m_rpcContexts;
-            m_internalData->m_rpcContexts.clear();
+            if (auto rpcContext = suspendedStream.lock())
+            {
+                rpcContext->WakeUp();
+            }
         }
 
-        // Cancel all grpc requests.
-        for (auto& context : contexts)
+        m_internalData->m_suspendedEventStreams.clear();
+
+        return true;
+    }
+
+    void CppPTSLClient::SuspendEventStream(std::shared_ptr<RequestState> state)
+    {
+        auto* alarm = new AsyncAlarm(
+            [this, state](bool)
+            {
+                state->m_rpcContext->EndBackoff();
+
+                if (state->m_rpcContext->IsCancelled())
+                {
+                    state->m_grpcStatus = grpc::Status { grpc::StatusCode::CANCELLED, "Request cancelled" };
+                    FinishRequest(state);
+                }
+                else
+                {
+                    ResumeEventStream(state);
+                }
+            });
+
+        bool isRestored = false;
+        bool isSuspended = false;
+
         {
-            // TryCancel is thread safe.
-            context->m_grpcContext.TryCancel();
+            std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+
+            // The connection was restored after this call had started, so it broke on the old connection.
+            isRestored = state->m_connectionGeneration != m_internalData->m_connectionGeneration;
+
+            if (!isRestored)
+            {
+                isSuspended = state->m_rpcContext->BeginBackoff(*alarm,
+                    m_internalData->m_asyncEngine->NextCompletionQueue(),
+                    std::chrono::system_clock::now() + EVENT_STREAM_SUSPEND_LIMIT);
+            }
+
+            if (isSuspended)
+            {
+                m_internalData->m_isConnectionLost = true;
+                m_internalData->m_suspendedEventStreams.push_back(state->m_rpcContext);
+            }
         }
 
-        if (!waitForCancel)
+        if (!isSuspended)
         {
+            delete alarm;
+
+            if (isRestored)
+            {
+                ResumeEventStream(std::move(state));
+            }
+            else
+            {
+                FinishRequest(std::move(state));
+            }
+
             return;
         }
 
-        std::list<std::weak_ptr<InternalData::RpcContext>> weakContexts;
-        for (auto& context : contexts)
+        // The watcher may not have noticed the lost connection yet; a quick probe triggers the restoration.
+        SetHostReady(false);
+
+        if (m_internalData->m_isInitialized && m_internalData->m_connectionWatcher)
         {
-            weakContexts.push_back(context);
+            m_internalData->m_connectionWatcher->RequestProbe();
         }
+    }
 
-        contexts.clear();
+    void CppPTSLClient::ResumeEventStream(std::shared_ptr<RequestState> state)
+    {
+        if (state->m_responseCallback)
+        {
+            CppPTSLResponse gapMarker { CommandId::CId_PollEvents };
+            gapMarker.SetStatus(CommandStatusType::TStatus_InProgress);
+            gapMarker.SetEventGap(true);
+
+            try
+            {
+                state->m_responseCallback(gapMarker);
+            }
+            catch (...)
+            {
+                state->m_callbackError = std::current_exception();
+                FinishRequest(std::move(state));
+                return;
+            }
+        }
 
-        // Wait for all contexts to be cleared.
-        while (!weakContexts.empty())
         {
-            weakContexts.remove_if([](const std::weak_ptr<InternalData::RpcContext>& weakContext) { return weakContext.lock() == nullptr; });
-            std::this_thread::yield();
+            std::lock_guard<std::mutex> lock(m_internalData->m_connectionSetupMutex);
+            state->m_grpcRequest->mutable_header()->set_session_id(m_internalData->m_sessionId.Load());
+            state->m_connectionGeneration = m_internalData->m_connectionGeneration;
         }
-    }
 
+        StartAttempt(std::move(state));
+    }
 } // namespace PTSLC_CPP
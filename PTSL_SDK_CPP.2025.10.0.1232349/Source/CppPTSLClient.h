@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -35,6 +39,19 @@ namespace PTSLC_CPP
      */
     struct [[deprecated("Deprecated starting in 2024.10.")]] DefaultRequestHandler;
 
+#if defined(PTSLC_CPP_COROUTINES)
+    class Executor;
+    class RequestAwaitable;
+    class ResponseStream;
+#endif
+
+    /**
+     * Request and response body types of the command with the id, see @ref PTSLC_CPP::CppPTSLClient::SendTyped
+     * "SendTyped". Defined for every command by the CppPTSLCommandTraits.h generated from PTSL.proto.
+     */
+    template <CommandId Id>
+    struct CommandTraits;
+
     /**
      * Async C++ client wrapper for handling gRPC async streaming requests and receiving responses.
      */
@@ -104,14 +121,168 @@ namespace PTSLC_CPP
          * Sends a JSON-based request to Pro Tools.
          * responseCallback provides an ability to process all respones (both intermediate and final) in realtime.
          * The callback is called from the service thread.
+         * Don't wait for futures returned by this client from within the callback: it blocks the service thread.
+         * Commands with intermediate responses are sent over a streaming call, all others over a unary call;
+         * see @ref PTSLC_CPP::CppPTSLRequest::SetRouting "SetRouting" to override this per request.
          */
         std::future<CppPTSLResponse> SendRequest(CppPTSLRequest request, std::function<void(const CppPTSLResponse&)> responseCallback = nullptr);
 
+        /**
+         * Sends a JSON-based request to Pro Tools without allocating a future or a thread.
+         * responseCallback is called for every (intermediate and final) response, completionCallback is called once
+         * with the final result of the request. Both callbacks are called from the service thread,
+         * or from the calling thread if the request fails before it is sent.
+         */
+        void SendRequest(CppPTSLRequest request,
+            std::function<void(const CppPTSLResponse&)> responseCallback,
+            std::function<void(const CppPTSLResponse&)> completionCallback);
+
+        /**
+         * Sends a request with a protobuf body to Pro Tools and returns the protobuf body of the final response, e.g.
+         * `client.SendTyped<CommandId::CId_GetClipList>(ptsl::GetClipListRequestBody {}).get().clips()`.
+         * The body types of the command are found at compile time in CommandTraits; include CppPTSLCommandTraits.h,
+         * which needs the PTSL.pb.h generated from PTSL.proto.
+         *
+         * The bodies pass to the client in the protobuf binary format, so they don't depend on the protobuf version
+         * the client is built with, and are converted to and from JSON with the codec generated from PTSL.proto,
+         * which is much faster than MessageToJsonString and JsonStringToMessage.
+         * The future holds a PTSLCommandException if the command fails or the response body can't be read.
+         */
+        template <CommandId Id>
+        std::future<typename CommandTraits<Id>::Response> SendTyped(const typename CommandTraits<Id>::Request& body,
+            std::function<void(const CppPTSLResponse&)> responseCallback = nullptr)
+        {
+            using Response = typename CommandTraits<Id>::Response;
+
+            auto promise = std::make_shared<std::promise<Response>>();
+            std::future<Response> fResponse = promise->get_future();
+
+            std::string binaryBody;
+            std::optional<std::string> requestBodyJson;
+
+            if (body.SerializeToString(&binaryBody))
+            {
+                requestBodyJson = RequestBodyToJson(Id, binaryBody);
+            }
+
+            if (!requestBodyJson)
+            {
+                promise->set_exception(std::make_exception_ptr(PTSLCommandException(
+                    std::string { "Can't convert the request body of " } + CommandTraits<Id>::NAME + " to JSON.")));
+                return fResponse;
+            }
+
+            SendRequest(CppPTSLRequest { Id, *requestBodyJson },
+                std::move(responseCallback),
+                [promise](const CppPTSLResponse& response)
+                {
+                    const TaskStatus status = response.GetStatus();
+
+                    if (status == TaskStatus::TStatus_Failed || status == TaskStatus::TStatus_FailedWithBadErrorResponse
+                        || status == TaskStatus::TStatus_NoResponseReceived)
+                    {
+                        promise->set_exception(std::make_exception_ptr(PTSLCommandException(
+                            response.GetResponseErrorJson(), CommandTraits<Id>::NAME, Id, response.GetTaskId())));
+                        return;
+                    }
+
+                    const std::optional<std::string> binaryResponseBody = ResponseBodyToBinary(Id, response);
+                    Response responseBody;
+
+                    if (status == TaskStatus::TStatus_CompletedWithBadResponse || !binaryResponseBody
+                        || !responseBody.ParseFromString(*binaryResponseBody))
+                    {
+                        promise->set_exception(std::make_exception_ptr(PTSLCommandException(
+                            std::string { "Can't read the response body of " } + CommandTraits<Id>::NAME + ".")));
+                        return;
+                    }
+
+                    promise->set_value(std::move(responseBody));
+                });
+
+            return fResponse;
+        }
+
+#if defined(PTSLC_CPP_COROUTINES)
+        /**
+         * Sends a JSON-based request to Pro Tools when the result is awaited with co_await
+         * and resumes the awaiting coroutine with the final response.
+         * Without an executor the coroutine is resumed on the service thread.
+         * Available when the SDK is built with PTSLC_CPP_ENABLE_COROUTINES; see CppPTSLCoroutines.h.
+         */
+        RequestAwaitable SendRequestAsync(CppPTSLRequest request, Executor* executor = nullptr);
+
+        /**
+         * Sends a JSON-based request to Pro Tools and returns an async stream of all its (intermediate and final)
+         * responses, consumed with `co_await stream.Next()`.
+         * Available when the SDK is built with PTSLC_CPP_ENABLE_COROUTINES; see CppPTSLCoroutines.h.
+         */
+        ResponseStream StreamRequestAsync(CppPTSLRequest request, Executor* executor = nullptr);
+#endif
+
         /**
          * Cancels all requests that are currently in progress.
          */
         void CancelRequests(bool waitForCancel = true);
 
+        /**
+         * Returns true if Pro Tools is ready to execute commands.
+         * The readiness is kept up to date by a background watcher of the connection.
+         */
+        bool IsHostReady() const;
+
+        /**
+         * Blocks until Pro Tools is ready to execute commands or the timeout expires.
+         * Returns true if the host is ready.
+         */
+        bool WaitUntilReady(std::chrono::milliseconds timeout);
+
+        /**
+         * Sets the callback called whenever Pro Tools becomes ready or stops being ready.
+         * The callback is called from the client's connection watcher thread and must not destroy the client.
+         */
+        void SetReadinessCallback(std::function<void(bool isHostReady)> callback);
+
+        /**
+         * Becomes ready when the client initialization is finished and holds whether Pro Tools was ready
+         * at that moment. Holds the exception if the initialization failed.
+         * Without ClientConfig::deferInit it is ready when the constructor returns.
+         */
+        std::shared_future<bool> Ready() const;
+
+        /**
+         * Returns the current state of the admission control, see ClientConfig::maxInFlightRequests.
+         * All values are zero if the client has no admission limits.
+         */
+        AdmissionMetrics GetAdmissionMetrics() const;
+
+        /**
+         * Returns the counters of the response cache, see ClientConfig::responseCacheTimeToLive.
+         * All values are zero if the client caches no commands.
+         */
+        ResponseCacheMetrics GetResponseCacheMetrics() const;
+
+        /**
+         * Removes all responses from the cache, e.g. after changing the session outside of this client.
+         */
+        void ClearResponseCache();
+
+        /**
+         * Watches a task running in Pro Tools, e.g. of a command that responded with TStatus_Queued.
+         *
+         * All watched tasks are polled with GetTaskStatus from one shared timer, see
+         * ClientConfig::taskStatusPollInterval. onStatusChanged is called on a service thread whenever the status or
+         * the progress of the task changes, the last time with a final status, i.e. completed or failed.
+         *
+         * @returns Id for StopWatchingTask; 0 if the client is being destroyed.
+         */
+        uint64_t WatchTask(const std::string& taskId, std::function<void(const TaskStatusUpdate&)> onStatusChanged);
+
+        /**
+         * Stops the notifications of a watcher started with WatchTask.
+         */
+        void StopWatchingTask(uint64_t watchId);
+
     public:
         /**
          * @deprecated All the API-specific functions (commands) are deprecated starting in Pro Tools 2024.10.
@@ -121,7 +292,7 @@ namespace PTSLC_CPP
          *
          * Only returns the status of the task that is currently in progress. 
          * So it should be called asynchronously in parallel to the requested PTSL Command 
-         * like it is implemented in @ref PTSLC_CPP::CppPTSLClient::PingTaskStatus.
+         * like it is implemented in @ref PTSLC_CPP::CppPTSLClient::WatchTask.
          * 
          * @returns task execution status
          */
@@ -1574,6 +1745,11 @@ namespace PTSLC_CPP
          */
         void Init();
 
+        /**
+         * Runs Init() and resolves Ready() with its outcome.
+         */
+        void CompleteInit();
+
         /**
          * Used to free up client resources.
          */
@@ -1587,19 +1763,13 @@ namespace PTSLC_CPP
 
     private:
         struct InternalData;
+        struct RequestState;
 
     private:
-        /**
-         * A client's session identifier.
-         * As a result of @ref RegisterConnection, this value is returned.
-         * With every subsequent command, this value is then passed.
-         */
-        std::string SessionId;
-
         /**
          * Flag which prevents commands execution if Host is not ready.
          */
-        bool m_isHostReady;
+        std::atomic<bool> m_isHostReady;
 
         /**
          * Settings which are used for client initialization.
@@ -1611,11 +1781,6 @@ namespace PTSLC_CPP
          */
         std::unique_ptr<InternalData> m_internalData;
 
-        /**
-         *  Used for synchronized access to the session id.
-         */
-        mutable std::mutex SessionIdMutex;
-
     private:
         /**
          * Starts the server. Use this method only for unit tests.
@@ -1626,12 +1791,22 @@ namespace PTSLC_CPP
         bool LocateServer();
 
         /**
-         * Internal client wrapper feature.
-         * Periodically checks the status of command execution with PING_TIMEOUT timeout.
-         * Called right after gRPC request sent to the server and terminate command execution
-         * if status of GetTaskStatus command execution is 'Failed'.
+         * Requests the status of a watched task with GetTaskStatus for the task monitor.
+         * onPolled receives nothing if the call itself failed.
          */
-        void PingTaskStatus(std::string responseReceivedTaskId, std::future<void> pingCancellationToken);
+        void PollTaskStatus(const std::string& taskId, std::function<void(std::optional<TaskStatusUpdate>)> onPolled);
+
+        /**
+         * Converts the request body of the command from the protobuf binary format to JSON, for SendTyped.
+         * Returns std::nullopt if the body can't be parsed.
+         */
+        static std::optional<std::string> RequestBodyToJson(CommandId commandId, const std::string& binaryBody);
+
+        /**
+         * Converts the response body JSON of the command to the protobuf binary format, for SendTyped.
+         * Returns std::nullopt if the body can't be parsed.
+         */
+        static std::optional<std::string> ResponseBodyToBinary(CommandId commandId, const CppPTSLResponse& response);
 
         /**
          * Fills error structure and sends to caller in case the server is not available.
@@ -1651,6 +1826,92 @@ namespace PTSLC_CPP
          */
         CppPTSLResponse SendHostNotReadyResponse(CommandId commandType);
 
-        std::string LookForSessionId(const std::string& responseBodyJson);
+        std::string LookForSessionId(const CppPTSLResponse& response);
+
+        /**
+         * Starts the request on the async engine. onComplete receives either the final response
+         * or the exception thrown from one of the user callbacks while processing the request.
+         */
+        void StartRequest(CppPTSLRequest request,
+            std::function<void(const CppPTSLResponse&)> responseCallback,
+            std::function<void(const CppPTSLResponse&, std::exception_ptr)> onComplete);
+
+        /**
+         * Sends the request without waiting for the host to become ready.
+         */
+        void DispatchRequest(CppPTSLRequest request,
+            std::function<void(const CppPTSLResponse&)> responseCallback,
+            std::function<void(const CppPTSLResponse&, std::exception_ptr)> onComplete);
+
+        /**
+         * Updates the readiness of the host: notifies waiters and the readiness callback,
+         * and sends the requests that were waiting for the host.
+         */
+        void SetHostReady(bool isHostReady);
+
+        /**
+         * Completes the request with the "host is not ready" error.
+         */
+        void FailHostNotReady(
+            CommandId commandId, const std::function<void(const CppPTSLResponse&, std::exception_ptr)>& onComplete);
+
+        /**
+         * Fails the requests that waited for the host longer than ClientConfig::hostReadyWaitTimeout
+         * and finishes the ones whose cancellation token was cancelled.
+         */
+        void ExpirePendingRequests(bool expireAll = false);
+
+        /**
+         * Starts the request once it gets an admission slot, see ClientConfig::maxInFlightRequests.
+         */
+        void AdmitRequest(std::shared_ptr<RequestState> state);
+
+        /**
+         * Sends the next attempt of the request.
+         */
+        void StartAttempt(std::shared_ptr<RequestState> state);
+
+        /**
+         * Retries the request after a backoff if the attempt failed transiently and the retry policy allows it,
+         * otherwise completes the request.
+         */
+        void OnAttemptFinished(std::shared_ptr<RequestState> state);
+
+        /**
+         * Delivers the final response of the request to the client and the caller.
+         */
+        void FinishRequest(std::shared_ptr<RequestState> state);
+
+        /**
+         * Evicts the cached responses that a finished command may have made stale,
+         * see ClientConfig::responseCacheTimeToLive.
+         */
+        void EvictStaleResponses(CommandId commandId);
+
+        /**
+         * Remembers the registration and the event subscriptions made by a successful request,
+         * so they can be restored after a reconnect.
+         */
+        void RecordConnectionSetup(const RequestState& state);
+
+        /**
+         * Repeats the remembered registration and event subscriptions if the connection was lost since they were made,
+         * then resumes the suspended PollEvents calls. Returns false if the state could not be restored.
+         */
+        bool RestoreConnectionSetup();
+
+        /**
+         * Parks a PollEvents call broken by a lost connection until the connection state is restored.
+         */
+        void SuspendEventStream(std::shared_ptr<RequestState> state);
+
+        /**
+         * Delivers the event gap marker and restarts a suspended PollEvents call on the restored session.
+         */
+        void ResumeEventStream(std::shared_ptr<RequestState> state);
     };
 } // namespace PTSLC_CPP
+
+#if defined(PTSLC_CPP_COROUTINES)
+#include "CppPTSLCoroutines.h"
+#endif
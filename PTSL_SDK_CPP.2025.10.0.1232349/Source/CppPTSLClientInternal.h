@@ -8,8 +8,17 @@
 
 #pragma once
 
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <unordered_map>
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -20,7 +29,17 @@
 
 #include "PTSL.grpc.pb.h"
 
+#include "CppPTSLAdmission.h"
+#include "CppPTSLArenaPool.h"
+#include "CppPTSLAsyncEngine.h"
+#include "CppPTSLCancellationToken.h"
+#include "CppPTSLChannelPool.h"
+#include "CppPTSLConnectionWatcher.h"
 #include "CppPTSLClient.h"
+#include "CppPTSLJsonCodec.h"
+#include "CppPTSLResponseCache.h"
+#include "CppPTSLRetry.h"
+#include "CppPTSLTaskMonitor.h"
 #include "PTSL_Versions.h"
 
 namespace PTSLC_CPP
@@ -28,8 +47,11 @@ namespace PTSLC_CPP
     /**
     * Common utility structure that contains grpc data
     * which are transferring between the grpc async calls.
+    *
+    * Serves as the tag of the legacy calls on InternalData::m_completionQueue: the poller thread of the queue
+    * hands each completed operation to the thread waiting for it, so concurrent calls never see each other's tags.
     */
-    class CallData
+    class CallData : public AsyncCallTag
     {
     public:
         CallData() = default;
@@ -37,6 +59,31 @@ namespace PTSLC_CPP
         ptsl::Response m_grpcResponse;
         grpc::ClientContext m_context;
         grpc::Status m_grpcStatus;
+
+        /**
+         * Blocks until the operation started with this tag completes. Returns its result, see Proceed.
+         */
+        bool WaitForCompletion()
+        {
+            std::unique_lock<std::mutex> lock(m_completionMutex);
+            m_completed.wait(lock, [this]() { return m_isCompleted; });
+            m_isCompleted = false;
+            return m_isOk;
+        }
+
+        void Proceed(bool ok) override
+        {
+            std::lock_guard<std::mutex> lock(m_completionMutex);
+            m_isOk = ok;
+            m_isCompleted = true;
+            m_completed.notify_one();
+        }
+
+    private:
+        std::mutex m_completionMutex;
+        std::condition_variable m_completed;
+        bool m_isCompleted = false;
+        bool m_isOk = false;
     };
 
     static google::protobuf::util::JsonOptions DefaultJsonWriteOptions()
@@ -52,6 +99,18 @@ namespace PTSLC_CPP
         return jOpts;
     }
 
+    /**
+     * Options for request bodies that only the server reads: no whitespace, and fields with default values are left
+     * out since the server parses them back to the same message anyway.
+     */
+    inline google::protobuf::util::JsonOptions CompactJsonWriteOptions()
+    {
+        google::protobuf::util::JsonOptions jOpts;
+        jOpts.add_whitespace = false;
+        jOpts.preserve_proto_field_names = true;
+        return jOpts;
+    }
+
     static google::protobuf::util::JsonParseOptions DefaultJsonParseOptions()
     {
         google::protobuf::util::JsonParseOptions jOpts;
@@ -59,6 +118,236 @@ namespace PTSLC_CPP
         return jOpts;
     }
 
+    /**
+     * Returns true if the command may produce intermediate responses (progress, queued task status, events)
+     * and thus has to be sent via SendGrpcStreamingRequest. All other commands answer with exactly one response
+     * and use the cheaper unary SendGrpcRequest.
+     */
+    inline bool IsStreamingCommand(CommandId commandId)
+    {
+        static const std::unordered_set<CommandId> streamingCommands {
+            CommandId::CId_CreateSession,
+            CommandId::CId_OpenSession,
+            CommandId::CId_Import,
+            CommandId::CId_ConsolidateClip,
+            CommandId::CId_ExportClipsAsFiles,
+            CommandId::CId_ExportSelectedTracksAsAAFOMF,
+            CommandId::CId_RefreshTargetAudioFiles,
+            CommandId::CId_RefreshAllModifiedAudioFiles,
+            CommandId::CId_SaveSession,
+            CommandId::CId_SaveSessionAs,
+            CommandId::CId_CloseSession,
+            CommandId::CId_ExportMix,
+            CommandId::CId_Spot,
+            CommandId::CId_ExportSessionInfoAsText,
+            CommandId::CId_CreateNewTracks,
+            CommandId::CId_ImportVideo,
+            CommandId::CId_RepeatSelection,
+            CommandId::CId_ImportAudioToClipList,
+            CommandId::CId_SpotClipsByID,
+            CommandId::CId_CreateBatchJob,
+            CommandId::CId_GetBatchJobStatus,
+            CommandId::CId_BounceTrack,
+            CommandId::CId_PollEvents,
+            CommandId::CId_CompleteBatchJob,
+            CommandId::CId_CancelBatchJob,
+            CommandId::CId_WriteSelectedTranscriptionToJSONFile,
+        };
+
+        return streamingCommands.count(commandId) != 0;
+    }
+
+    /**
+     * Returns true if the command doesn't change the state of Pro Tools, so sending it again is harmless.
+     */
+    inline bool IsReadOnlyCommand(CommandId commandId)
+    {
+        static const std::unordered_set<CommandId> readOnlyCommands {
+            CommandId::CId_GetTrackList,
+            CommandId::CId_GetTaskStatus,
+            CommandId::CId_HostReadyCheck,
+            CommandId::CId_GetFileLocation,
+            CommandId::CId_GetDynamicProperties,
+            CommandId::CId_GetSessionAudioFormat,
+            CommandId::CId_GetSessionSampleRate,
+            CommandId::CId_GetSessionBitDepth,
+            CommandId::CId_GetSessionInterleavedState,
+            CommandId::CId_GetSessionTimeCodeRate,
+            CommandId::CId_GetSessionFeetFramesRate,
+            CommandId::CId_GetSessionAudioRatePullSettings,
+            CommandId::CId_GetSessionVideoRatePullSettings,
+            CommandId::CId_GetSessionName,
+            CommandId::CId_GetSessionPath,
+            CommandId::CId_GetSessionStartTime,
+            CommandId::CId_GetSessionLength,
+            CommandId::CId_GetPTSLVersion,
+            CommandId::CId_GetPlaybackMode,
+            CommandId::CId_GetRecordMode,
+            CommandId::CId_GetTransportArmed,
+            CommandId::CId_GetTransportState,
+            CommandId::CId_GetMemoryLocations,
+            CommandId::CId_GetEditMode,
+            CommandId::CId_GetEditTool,
+            CommandId::CId_GetEditModeOptions,
+            CommandId::CId_GetTimelineSelection,
+            CommandId::CId_GetSessionIDs,
+            CommandId::CId_GetMemoryLocationsManageMode,
+            CommandId::CId_GetMainCounterFormat,
+            CommandId::CId_GetSubCounterFormat,
+            CommandId::CId_GetSessionSystemDelayInfo,
+            CommandId::CId_GetTimeAsType,
+            CommandId::CId_SubtractLocations,
+            CommandId::CId_AddLengthToLocation,
+            CommandId::CId_SubtractPositions,
+            CommandId::CId_AddLengthToPositions,
+            CommandId::CId_GetClipList,
+            CommandId::CId_GetMediaFileInfo,
+            CommandId::CId_GetExportMixSourceList,
+            CommandId::CId_GetMonitorOutputPath,
+            CommandId::CId_GetEditSelection,
+            CommandId::CId_GetBatchJobStatus,
+            CommandId::CId_GetTrackControlInfo,
+            CommandId::CId_GetTrackControlValue,
+            CommandId::CId_GetTrackPlaylists,
+            CommandId::CId_GetColorPalette,
+            CommandId::CId_GetPlaylistElements,
+        };
+
+        return readOnlyCommands.count(commandId) != 0;
+    }
+
+    /**
+     * Returns true if the request is sent over SendGrpcStreamingRequest.
+     */
+    inline bool IsStreamingRequest(const CppPTSLRequest& request)
+    {
+        return request.GetRouting() == RequestRouting::RRouting_Auto
+            ? IsStreamingCommand(request.GetCommandId())
+            : request.GetRouting() == RequestRouting::RRouting_Streaming;
+    }
+
+    /**
+     * Returns true if the command bypasses the admission queue. Mirrors the server, which executes event and
+     * batch job control commands ahead of the other commands; in addition event streams would hold their slot
+     * forever and readiness probes must not wait behind the requests they decide about.
+     */
+    inline bool IsAdmissionExempt(CommandId commandId)
+    {
+        switch (commandId)
+        {
+            case CommandId::CId_HostReadyCheck:
+            case CommandId::CId_GetTaskStatus:
+            case CommandId::CId_PollEvents:
+            case CommandId::CId_SubscribeToEvents:
+            case CommandId::CId_UnsubscribeFromEvents:
+            case CommandId::CId_CreateBatchJob:
+            case CommandId::CId_GetBatchJobStatus:
+            case CommandId::CId_CompleteBatchJob:
+            case CommandId::CId_CancelBatchJob:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Returns true if the request may share its call with identical requests, see ClientConfig::singleFlightCommands.
+     */
+    inline bool IsSingleFlightRequest(const CppPTSLRequest& request, const ClientConfig& config)
+    {
+        return !config.singleFlightCommands.empty() && config.singleFlightCommands.count(request.GetCommandId()) != 0
+            && IsReadOnlyCommand(request.GetCommandId()) && !IsStreamingRequest(request)
+            && !request.GetCancellationToken();
+    }
+
+    /**
+     * Returns true if the response to the request may come from the cache, see ClientConfig::responseCacheTimeToLive.
+     */
+    inline bool IsCachedRequest(const CppPTSLRequest& request, const ResponseCache* cache)
+    {
+        return cache && cache->IsCached(request.GetCommandId()) && !IsStreamingRequest(request);
+    }
+
+    /**
+     * Returns true if the PollEvents response reports a session opened, created or closed.
+     */
+    inline bool IsSessionChangeEvent(const CppPTSLResponse& response)
+    {
+        const std::string_view body = response.GetResponseBodyJsonView();
+
+        return body.find("EId_Session") != std::string_view::npos
+            && (body.find("EId_SessionOpened") != std::string_view::npos
+                || body.find("EId_SessionCreated") != std::string_view::npos
+                || body.find("EId_SessionClosed") != std::string_view::npos);
+    }
+
+    /**
+     * Identity of the request for the single-flight calls and the response cache.
+     */
+    inline RequestKey MakeRequestKey(const CppPTSLRequest& request, const std::string& clientSessionId)
+    {
+        const std::string requestSessionId = request.GetSessionId();
+
+        return RequestKey { request.GetCommandId(),
+            requestSessionId.empty() ? clientSessionId : requestSessionId,
+            request.GetVersion(),
+            request.GetVersionMinor(),
+            request.GetVersionRevision(),
+            request.GetVersionedRequestHeaderJson(),
+            request.GetRequestBodyJson() };
+    }
+
+    /**
+     * Identity of a single-flight call. The requests sharing a call also share its deadline, retries and admission,
+     * so besides being identical they need the same settings.
+     */
+    struct SingleFlightKey
+    {
+        RequestKey m_requestKey;
+        std::chrono::milliseconds m_timeout;
+        RetryPolicy m_retryPolicy;
+        RequestPriority m_priority;
+
+        bool operator==(const SingleFlightKey& other) const
+        {
+            return m_timeout == other.m_timeout && m_priority == other.m_priority
+                && m_retryPolicy.mode == other.m_retryPolicy.mode
+                && m_retryPolicy.maxAttempts == other.m_retryPolicy.maxAttempts
+                && m_retryPolicy.initialBackoff == other.m_retryPolicy.initialBackoff
+                && m_retryPolicy.maxBackoff == other.m_retryPolicy.maxBackoff
+                && m_retryPolicy.attemptTimeout == other.m_retryPolicy.attemptTimeout
+                && m_requestKey == other.m_requestKey;
+        }
+    };
+
+    struct SingleFlightKeyHash
+    {
+        size_t operator()(const SingleFlightKey& key) const
+        {
+            // requests differing only by their settings are rare, so the request alone spreads the keys well
+            return RequestKeyHash {}(key.m_requestKey) ^ static_cast<size_t>(key.m_timeout.count());
+        }
+    };
+
+    inline SingleFlightKey MakeSingleFlightKey(const CppPTSLRequest& request, const std::string& clientSessionId)
+    {
+        return SingleFlightKey { MakeRequestKey(request, clientSessionId),
+            request.GetTimeout(),
+            request.GetRetryPolicy(),
+            request.GetPriority() };
+    }
+
+    inline CommandClass GetCommandClass(CommandId commandId, bool isStreaming)
+    {
+        if (isStreaming)
+        {
+            return CommandClass::CClass_Streaming;
+        }
+
+        return IsReadOnlyCommand(commandId) ? CommandClass::CClass_ReadOnly : CommandClass::CClass_Modifying;
+    }
+
     /**
      * PTSL specific exception class.
      * Used only internally in the PTSLC_CPP::CppPTSLClient.
@@ -79,23 +368,401 @@ namespace PTSLC_CPP
      */
     struct CppPTSLClient::InternalData
     {
-        struct RpcContext
+        class RpcContextRegistry;
+
+        /**
+         * Cancellation handle of a request that is in progress.
+         * A request may go through several attempts, each one with its own grpc::ClientContext,
+         * and wait for the next attempt on a backoff alarm.
+         */
+        class RpcContext
         {
-            grpc::ClientContext m_grpcContext;
+        public:
+            RpcContext() = default;
+            RpcContext(const RpcContext&) = delete;
+            RpcContext& operator=(const RpcContext&) = delete;
+
+            /**
+             * Leaves the registry the context was added to.
+             */
+            ~RpcContext();
+
+            /**
+             * Makes grpcContext the context of the current attempt. Returns false if the request was cancelled.
+             */
+            bool BeginAttempt(std::shared_ptr<grpc::ClientContext> grpcContext)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_grpcContext = std::move(grpcContext);
+                return !m_isCancelled;
+            }
+
+            /**
+             * Sets the alarm that starts the next attempt. Returns false if the request was cancelled.
+             */
+            bool BeginBackoff(
+                AsyncAlarm& alarm, grpc::CompletionQueue& completionQueue, std::chrono::system_clock::time_point deadline)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                if (m_isCancelled)
+                {
+                    return false;
+                }
+
+                m_backoffAlarm = &alarm;
+                alarm.Set(completionQueue, deadline);
+                return true;
+            }
+
+            /**
+             * Called from the alarm handler before the alarm is destroyed.
+             */
+            void EndBackoff()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_backoffAlarm = nullptr;
+            }
+
+            void Cancel()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_isCancelled = true;
+
+                // Both calls are thread safe and only schedule the cancellation.
+                if (m_grpcContext)
+                {
+                    m_grpcContext->TryCancel();
+                }
+
+                if (m_backoffAlarm)
+                {
+                    m_backoffAlarm->Cancel();
+                }
+            }
+
+            /**
+             * Fires the alarm of the current backoff early. The alarm handler tells it from a cancellation with IsCancelled().
+             */
+            void WakeUp()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                if (m_backoffAlarm)
+                {
+                    m_backoffAlarm->Cancel();
+                }
+            }
+
+            bool IsCancelled() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_isCancelled;
+            }
+
+        private:
+            friend class RpcContextRegistry;
+
+            mutable std::mutex m_mutex;
+            bool m_isCancelled = false;
+            std::shared_ptr<grpc::ClientContext> m_grpcContext;
+            AsyncAlarm* m_backoffAlarm = nullptr;
+
+            RpcContextRegistry* m_registry = nullptr;
+            void* m_registryNode = nullptr;
+        };
+
+        /**
+         * Contexts of the requests in progress, used to cancel them all.
+         *
+         * Requests are added with a single CAS on the head of an intrusive list and leave it by flagging their node
+         * when their RpcContext is destroyed, so sending and finishing requests never wait for each other.
+         * The flagged nodes are unlinked by whoever walks the list under m_sweepMutex: CancelAll, or an Add that
+         * finds the mutex free. The head node is never unlinked, so Add doesn't race with the sweep.
+         */
+        class RpcContextRegistry
+        {
+        public:
+            RpcContextRegistry() = default;
+            RpcContextRegistry(const RpcContextRegistry&) = delete;
+            RpcContextRegistry& operator=(const RpcContextRegistry&) = delete;
+
+            ~RpcContextRegistry()
+            {
+                for (Node* node = m_head.load(); node;)
+                {
+                    Node* next = node->m_next;
+                    delete node;
+                    node = next;
+                }
+            }
+
+            void Add(const std::shared_ptr<RpcContext>& context)
+            {
+                Node* node = new Node;
+                node->m_context = context;
+                context->m_registry = this;
+                context->m_registryNode = node;
+
+                node->m_next = m_head.load(std::memory_order_relaxed);
+                while (!m_head.compare_exchange_weak(node->m_next, node))
+                {
+                }
+
+                if (m_addCount.fetch_add(1, std::memory_order_relaxed) % SWEEP_INTERVAL == 0)
+                {
+                    std::unique_lock<std::mutex> lock(m_sweepMutex, std::try_to_lock);
+
+                    if (lock.owns_lock())
+                    {
+                        Sweep();
+                    }
+                }
+            }
+
+            /**
+             * Cancels all the requests in progress and optionally waits until their contexts are destroyed,
+             * i.e. until their completion handlers have returned.
+             */
+            void CancelAll(bool waitForCancel)
+            {
+                std::lock_guard<std::mutex> lock(m_sweepMutex);
+
+                std::vector<Node*> cancelledNodes;
+
+                for (Node* node = m_head.load(); node; node = node->m_next)
+                {
+                    if (node->m_isReleased)
+                    {
+                        continue;
+                    }
+
+                    if (auto context = node->m_context.lock())
+                    {
+                        context->Cancel();
+                    }
+
+                    cancelledNodes.push_back(node);
+                }
+
+                if (waitForCancel)
+                {
+                    // Paired with the check in Release: either Release sees the waiter or the waiter sees the flag.
+                    ++m_waiterCount;
+
+                    std::unique_lock<std::mutex> releaseLock(m_releaseMutex);
+                    m_released.wait(releaseLock,
+                        [&cancelledNodes]()
+                        {
+                            return std::all_of(cancelledNodes.begin(),
+                                cancelledNodes.end(),
+                                [](const Node* node) { return node->m_isReleased.load(); });
+                        });
+
+                    --m_waiterCount;
+                }
+
+                Sweep();
+            }
+
+            /**
+             * Called from the destructor of the context. The node must not be touched after it's flagged:
+             * a concurrent sweep may delete it right away.
+             */
+            void Release(void* registryNode)
+            {
+                static_cast<Node*>(registryNode)->m_isReleased = true;
+
+                if (m_waiterCount > 0)
+                {
+                    std::lock_guard<std::mutex> lock(m_releaseMutex);
+                    m_released.notify_all();
+                }
+            }
+
+        private:
+            static constexpr uint32_t SWEEP_INTERVAL = 64;
+
+            struct Node
+            {
+                std::weak_ptr<RpcContext> m_context;
+                Node* m_next = nullptr;
+                std::atomic<bool> m_isReleased { false };
+            };
+
+            /// Unlinks and deletes the released nodes, except the head. Requires m_sweepMutex.
+            void Sweep()
+            {
+                Node* previous = m_head.load();
+
+                while (previous && previous->m_next)
+                {
+                    Node* node = previous->m_next;
+
+                    if (node->m_isReleased)
+                    {
+                        previous->m_next = node->m_next;
+                        delete node;
+                    }
+                    else
+                    {
+                        previous = node;
+                    }
+                }
+            }
+
+            std::atomic<Node*> m_head { nullptr };
+            std::atomic<uint32_t> m_addCount { 0 };
+            std::mutex m_sweepMutex;
+
+            std::atomic<int32_t> m_waiterCount { 0 };
+            std::mutex m_releaseMutex;
+            std::condition_variable m_released;
         };
 
+        /**
+         * The client's session identifier, returned by RegisterConnection and passed with every subsequent command.
+         *
+         * Read on every request without locking: each value is published as an immutable shared string,
+         * and a reader keeps the string it loaded alive until it is done copying it.
+         * A replaced string is freed once its last reader lets go of it.
+         */
+        class SessionIdSlot
+        {
+        public:
+            std::string Load() const
+            {
+#if defined(__cpp_lib_atomic_shared_ptr)
+                return *m_current.load(std::memory_order_acquire);
+#else
+                return *std::atomic_load_explicit(&m_current, std::memory_order_acquire);
+#endif
+            }
+
+            void Store(const std::string& sessionId)
+            {
+                auto value = std::make_shared<const std::string>(sessionId);
+#if defined(__cpp_lib_atomic_shared_ptr)
+                m_current.store(std::move(value), std::memory_order_release);
+#else
+                std::atomic_store_explicit(&m_current, std::move(value), std::memory_order_release);
+#endif
+            }
+
+        private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+            std::atomic<std::shared_ptr<const std::string>> m_current { std::make_shared<const std::string>() };
+#else
+            std::shared_ptr<const std::string> m_current = std::make_shared<const std::string>();
+#endif
+        };
+
+        SessionIdSlot m_sessionId;
+
+        /// Connections to the server used by SendRequest.
+        std::unique_ptr<ChannelPool> m_channelPool;
+
         /// The ptsl::PTSL::Stub aka m_client, our view of the server's exposed services.
-        std::unique_ptr<ptsl::PTSL::Stub> m_client;
+        /// Stub of the primary channel of m_channelPool, used by the legacy request handlers.
+        ptsl::PTSL::Stub* m_client = nullptr;
 
         /// The producer-consumer queue we use to communicate asynchronously with the gRPC runtime.
+        /// Used by the legacy request handlers, with CallData as the tags.
         grpc::CompletionQueue m_completionQueue;
 
+        /// Drains m_completionQueue and wakes up the legacy call each completed tag belongs to.
+        std::thread m_completionQueuePoller;
+
+        /// Poller threads and completion queues that drive all SendRequest calls.
+        std::unique_ptr<AsyncEngine> m_asyncEngine;
+
+        /// Arenas the messages of the SendRequest calls are allocated on.
+        std::unique_ptr<ArenaPool> m_arenaPool;
+
+        /// Version fields shared by the headers of all SendRequest calls, copied into each request.
+        ptsl::RequestHeader m_requestHeaderPrototype;
+
         /// map a request ID to the response message
         std::map<std::string, ptsl::Response> m_responsePool;
 
+        /// Request sent while the host was not ready, waiting for the host.
+        struct PendingRequest
+        {
+            CppPTSLRequest m_request;
+            std::function<void(const CppPTSLResponse&)> m_responseCallback;
+            std::function<void(const CppPTSLResponse&, std::exception_ptr)> m_onComplete;
+            std::chrono::steady_clock::time_point m_expiresAt;
+        };
+
         /// Active RPC calls
-        std::list<std::shared_ptr<RpcContext>> m_rpcContexts;
-        std::mutex m_rpcContextsMutex;
+        RpcContextRegistry m_rpcContexts;
+
+        /// Set by the destructor before it cancels the active calls; no new calls are started afterwards.
+        std::atomic<bool> m_isShuttingDown { false };
+
+        /// Keeps CppPTSLClient::m_isHostReady up to date.
+        std::unique_ptr<ConnectionWatcher> m_connectionWatcher;
+
+        std::mutex m_readinessMutex;
+        std::condition_variable m_readinessChanged;
+        std::function<void(bool)> m_readinessCallback;
+
+        /// Requests waiting for the host to become ready, in the order they were sent.
+        std::deque<PendingRequest> m_pendingRequests;
+        std::mutex m_pendingRequestsMutex;
+
+        /// Result of Init(), see CppPTSLClient::Ready.
+        std::promise<bool> m_initPromise;
+        std::shared_future<bool> m_initFuture = m_initPromise.get_future().share();
+
+        /// Set once Init() is finished; until then requests wait for the host regardless of hostReadyWaitTimeout.
+        std::atomic<bool> m_isInitialized { false };
+
+        /// Runs Init() when ClientConfig::deferInit is set.
+        std::thread m_initThread;
+
+        /// Connection state restored after Pro Tools restarts, see ClientConfig::autoReconnect.
+        std::mutex m_connectionSetupMutex;
+        std::optional<std::string> m_registrationBodyJson;
+        std::set<std::pair<int32_t, std::string>> m_eventSubscriptions; ///< event id and event_data_json
+
+        /// Set when the connection is lost while a registration exists; cleared once the state is restored.
+        bool m_isConnectionLost = false;
+
+        /// Incremented on every restoration; lets a PollEvents call tell whether it ran on the restored session.
+        uint64_t m_connectionGeneration = 0;
+
+        /// PollEvents calls waiting for the restoration.
+        std::vector<std::weak_ptr<RpcContext>> m_suspendedEventStreams;
+
+        /// Throttles retries of all requests of the client.
+        std::unique_ptr<RetryBudget> m_retryBudget;
+
+        /// Limits the requests in flight; null if ClientConfig sets no limits.
+        std::unique_ptr<AdmissionController> m_admission;
+
+        /// Callers waiting for the result of an identical request in flight.
+        struct SingleFlightCall
+        {
+            struct Follower
+            {
+                std::function<void(const CppPTSLResponse&)> m_responseCallback;
+                std::function<void(const CppPTSLResponse&, std::exception_ptr)> m_onComplete;
+            };
+
+            std::vector<Follower> m_followers;
+
+            /// Set if the callback of the leader threw: the call was stopped without a response for the followers.
+            bool m_isLeaderCallbackFailed = false;
+        };
+
+        std::unordered_map<SingleFlightKey, std::shared_ptr<SingleFlightCall>, SingleFlightKeyHash> m_singleFlightCalls;
+        std::mutex m_singleFlightMutex;
+
+        /// Null if ClientConfig caches no commands.
+        std::unique_ptr<ResponseCache> m_responseCache;
+
+        std::unique_ptr<TaskMonitor> m_taskMonitor;
 
 #if defined(_WIN32)
         HMODULE m_winHandle = nullptr;
@@ -103,4 +770,64 @@ namespace PTSLC_CPP
         void* m_macHandle = nullptr;
 #endif
     };
+
+    inline CppPTSLClient::InternalData::RpcContext::~RpcContext()
+    {
+        if (m_registry)
+        {
+            m_registry->Release(m_registryNode);
+        }
+    }
+
+    /**
+     * State of a request sent with SendRequest, shared by all its attempts.
+     * The handlers of a single attempt are invoked sequentially from one poller thread,
+     * and attempts never overlap, so no synchronization is needed.
+     */
+    struct CppPTSLClient::RequestState
+    {
+        CommandId m_commandId = CommandId::CId_None;
+
+        /// Allocated on m_arena. The response message is reused by all attempts.
+        ptsl::Request* m_grpcRequest = nullptr;
+        ptsl::Response* m_grpcResponse = nullptr;
+
+        bool m_isStreaming = false;
+        bool m_isRetryable = false;
+        RetryPolicy m_retryPolicy;
+
+        /// Deadline of the whole request, see CppPTSLRequest::SetTimeout; time_point::max() if it has none.
+        std::chrono::system_clock::time_point m_deadline = std::chrono::system_clock::time_point::max();
+        int32_t m_attempt = 0;
+
+        /// PollEvents call which is suspended instead of failing when the connection is lost, see ClientConfig::autoReconnect.
+        bool m_isResumable = false;
+        uint64_t m_connectionGeneration = 0;
+
+        /// Status of the last finished attempt.
+        grpc::Status m_grpcStatus;
+
+        /// Admission slot of the request, see ClientConfig::maxInFlightRequests.
+        CommandClass m_commandClass = CommandClass::CClass_ReadOnly;
+        RequestPriority m_priority = RequestPriority::RPriority_Normal;
+        bool m_isAdmitted = false;
+        std::chrono::steady_clock::time_point m_admittedAt;
+        std::shared_ptr<AdmissionController::Waiter> m_admissionWaiter;
+
+        CppPTSLResponse m_response { CommandId::CId_None };
+        bool m_hasResponses = false;
+        std::exception_ptr m_callbackError;
+
+        std::function<void(const CppPTSLResponse&)> m_responseCallback;
+        std::function<void(const CppPTSLResponse&, std::exception_ptr)> m_onComplete;
+
+        std::shared_ptr<InternalData::RpcContext> m_rpcContext;
+
+        /// See CppPTSLRequest::SetCancellationToken. The callback cancels m_rpcContext.
+        std::optional<CancellationToken> m_cancellationToken;
+        CancellationToken::CallbackId m_cancellationCallbackId = 0;
+
+        /// Declared last so that it's released before m_rpcContext, which CancelRequests waits for.
+        ArenaPool::ArenaLease m_arena;
+    };
 } // namespace PTSLC_CPP
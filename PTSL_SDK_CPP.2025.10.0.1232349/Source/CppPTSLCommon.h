@@ -53,6 +53,23 @@ namespace PTSLC_CPP
         SHLaunch_No = 1
     };
 
+    enum class CommandId : int32_t;
+
+    /**
+     * Group of commands with its own admission limit, see ClientConfig::maxInFlightRequestsPerClass.
+     */
+    enum class CommandClass : int32_t
+    {
+        /** Commands that only read the state of Pro Tools: the Get* family and the time calculation commands */
+        CClass_ReadOnly = 0,
+
+        /** Commands with a single response that change the state of Pro Tools */
+        CClass_Modifying = 1,
+
+        /** Requests sent over a streaming call: exports, imports, bounces, batch jobs */
+        CClass_Streaming = 2
+    };
+
     /**
      * Structure that describes data needed for client's configuring.
      */
@@ -61,6 +78,133 @@ namespace PTSLC_CPP
         std::string address;
         Mode serverMode;
         SkipHostLaunch skipHostLaunch;
+
+        /**
+         * Number of threads that poll the gRPC completion queues of the client.
+         * 0 selects a default based on the number of hardware threads.
+         */
+        int32_t pollerThreadCount = 0;
+
+        /**
+         * Number of connections to the server shared by the requests without intermediate responses.
+         * Each request goes to the connection with the least outstanding requests. Values below 1 are treated as 1.
+         */
+        int32_t channelCount = 1;
+
+        /**
+         * Sends the streaming requests (exports, imports, bounces, events, batch jobs) over a separate connection,
+         * so they don't slow down short requests.
+         */
+        bool useDedicatedStreamingChannel = true;
+
+        /**
+         * Size of the retry budget shared by all requests of the client.
+         * Every failed attempt takes one token and every successful request returns a fraction of a token;
+         * retries are suspended while less than half of the tokens are left, e.g. while Pro Tools is restarting.
+         * Values below 1 disable retries.
+         */
+        int32_t retryBudgetTokens = 10;
+
+        /**
+         * Fraction of a token returned to the retry budget by every successful request.
+         */
+        double retryBudgetTokenRatio = 0.1;
+
+        /**
+         * Interval of the background HostReadyCheck probes while the host is ready.
+         * While the host is not ready (still loading, restarting) it is probed several times per second.
+         */
+        std::chrono::milliseconds hostProbeInterval { 5000 };
+
+        /**
+         * How long a request sent while the host is not ready waits for it before failing
+         * with CEType_OS_ProToolsIsNotAvailable. Zero makes such requests fail immediately.
+         */
+        std::chrono::milliseconds hostReadyWaitTimeout { 3000 };
+
+        /**
+         * Makes the constructor return immediately and run the initialization (host launch, server lookup
+         * and the first HostReadyCheck) in the background; see @ref PTSLC_CPP::CppPTSLClient::Ready.
+         * Requests sent in the meantime wait until the initialization is finished.
+         */
+        bool deferInit = false;
+
+        /**
+         * Restores the connection state after Pro Tools restarts: repeats the last successful RegisterConnection
+         * (refreshing the session id), repeats the active SubscribeToEvents subscriptions and resumes the running
+         * PollEvents requests. A resumed PollEvents request first delivers a response with
+         * @ref PTSLC_CPP::CppPTSLResponse::IsEventGap "IsEventGap" set to its response callback.
+         */
+        bool autoReconnect = false;
+
+        /**
+         * Maximum number of requests sent to Pro Tools at the same time. Pro Tools executes most commands one
+         * after another, so the requests over the limit wait in the client instead of queueing up on the server,
+         * and are sent by their @ref PTSLC_CPP::CppPTSLRequest::SetPriority "priority". 0 disables the limit.
+         * HostReadyCheck, event and batch job control commands are never limited.
+         */
+        int32_t maxInFlightRequests = 0;
+
+        /**
+         * Additional limits for the classes of commands, e.g. to keep a long import from occupying
+         * all the slots needed by interactive queries. Classes that aren't listed are only limited by maxInFlightRequests.
+         */
+        std::map<CommandClass, int32_t> maxInFlightRequestsPerClass;
+
+        /**
+         * Makes the limit of maxInFlightRequests adaptive (additive increase, multiplicative decrease):
+         * it grows while the latency of the requests stays close to the lowest observed latency and shrinks
+         * when the latency inflates or the requests time out. maxInFlightRequests stays its upper bound.
+         */
+        bool adaptiveConcurrency = false;
+
+        /**
+         * Makes SendRequest block the calling thread while the admission limits are reached, so producers of
+         * many requests are slowed down instead of filling the client's queue. Never blocks the service threads.
+         */
+        bool blockOnAdmission = false;
+
+        /**
+         * A request waiting for an admission slot gains one priority level per interval it waits,
+         * e.g. with the default a bulk request waits at most 4 seconds behind newer interactive requests.
+         */
+        std::chrono::milliseconds priorityAgingInterval { 2000 };
+
+        /**
+         * Read-only commands whose identical concurrent requests share a single call to Pro Tools: a request sent
+         * while an identical one (same command, session, version and body, and the same timeout, retry policy and
+         * priority) is in flight completes with the response of that one instead of being sent. The responses share
+         * their body. If the callback of the first request throws, the call is stopped and the others are sent again.
+         * Commands that change the state of Pro Tools, streaming requests and requests with a cancellation token
+         * are never shared.
+         */
+        std::unordered_set<CommandId> singleFlightCommands;
+
+        /**
+         * Read-only commands whose successful responses are cached, and how long. A request identical to a cached
+         * one (same command, session, version and body) completes with the cached response without being sent.
+         * Commands that change the state of Pro Tools evict the responses they may have made stale when they finish,
+         * e.g. SetSessionBitDepth evicts GetSessionBitDepth and CreateNewTracks evicts GetTrackList;
+         * commands with unknown effects and session opened, created or closed events evict all of them.
+         * Commands that change the state of Pro Tools and streaming requests are never cached.
+         */
+        std::map<CommandId, std::chrono::milliseconds> responseCacheTimeToLive;
+
+        /**
+         * Upper limit of the responses in the cache, see responseCacheTimeToLive.
+         * A new response takes the place of the one that expires first once the limit is reached.
+         */
+        int32_t responseCacheMaxEntries = 1024;
+
+        /**
+         * Interval between two GetTaskStatus polls of a watched task right after it started or changed its status,
+         * see CppPTSLClient::WatchTask. While the status stays the same, the interval doubles up to
+         * maxTaskStatusPollInterval.
+         */
+        std::chrono::milliseconds taskStatusPollInterval { 250 };
+
+        /** Upper limit of the interval between two GetTaskStatus polls of a watched task */
+        std::chrono::milliseconds maxTaskStatusPollInterval { 5000 };
     };
 
     /**
@@ -701,6 +845,129 @@ namespace PTSLC_CPP
      */
     using CommandStatusType = TaskStatus;
 
+    /**
+     * gRPC method used to deliver a request to the server.
+     */
+    enum class RequestRouting : int32_t
+    {
+        /** Choose the method by the command: streaming for commands with intermediate responses, unary otherwise */
+        RRouting_Auto = 0,
+
+        /** Always use the unary SendGrpcRequest method; only the final response is delivered */
+        RRouting_Unary = 1,
+
+        /** Always use the server-streaming SendGrpcStreamingRequest method */
+        RRouting_Streaming = 2
+    };
+
+    /**
+     * Order in which the requests waiting for an admission slot are sent, see ClientConfig::maxInFlightRequests.
+     */
+    enum class RequestPriority : int32_t
+    {
+        /** Requests triggered by a user action, e.g. a click that reads the transport state or solos a track */
+        RPriority_Interactive = 0,
+
+        /** Default priority */
+        RPriority_Normal = 1,
+
+        /** Background work such as exporting many stems; gets ahead of newer requests as it waits, so it can't starve */
+        RPriority_Bulk = 2
+    };
+
+    /**
+     * Defines which requests the client may send again after a transient transport failure.
+     */
+    enum class RetryMode : int32_t
+    {
+        /** Retry only read-only commands: the Get* family, HostReadyCheck and the time calculation commands */
+        RMode_Auto = 0,
+
+        /** Never retry the request */
+        RMode_Never = 1,
+
+        /** Retry the request whatever the command is. Opt in only if executing the command twice is harmless */
+        RMode_Always = 2
+    };
+
+    /**
+     * Retry settings of a single request.
+     *
+     * A request is retried only if the server was unavailable or the attempt exceeded its deadline,
+     * no response was delivered to the caller yet, and the client's retry budget is not exhausted.
+     */
+    struct RetryPolicy
+    {
+        RetryMode mode = RetryMode::RMode_Auto;
+
+        /** Total number of attempts, including the first one */
+        int32_t maxAttempts = 3;
+
+        /** Delay before the first retry; doubled for every next retry and randomized to avoid synchronized retries */
+        std::chrono::milliseconds initialBackoff { 100 };
+
+        /** Upper limit of the delay between two attempts */
+        std::chrono::milliseconds maxBackoff { 2000 };
+
+        /**
+         * Deadline of a single attempt, counted from the moment it is sent, so a stalled attempt leaves time to retry.
+         * Never extends the deadline of the whole request, see CppPTSLRequest::SetTimeout. Zero (default): no limit.
+         */
+        std::chrono::milliseconds attemptTimeout { 0 };
+    };
+
+    /**
+     * Snapshot of the admission control of a client, see ClientConfig::maxInFlightRequests.
+     */
+    struct AdmissionMetrics
+    {
+        /** Requests sent to Pro Tools and not finished yet */
+        int32_t inFlightRequests = 0;
+
+        /** Requests waiting for a free slot */
+        int32_t queuedRequests = 0;
+
+        /** Current limit of the in-flight requests; changes over time with ClientConfig::adaptiveConcurrency */
+        int32_t concurrencyLimit = 0;
+
+        /** Requests that had to wait for a slot, and their total and longest wait */
+        uint64_t delayedRequests = 0;
+        std::chrono::microseconds totalWaitTime { 0 };
+        std::chrono::microseconds maxWaitTime { 0 };
+    };
+
+    /**
+     * Counters of the response cache of a client, see ClientConfig::responseCacheTimeToLive.
+     */
+    struct ResponseCacheMetrics
+    {
+        /** Requests completed from the cache */
+        uint64_t hits = 0;
+
+        /** Requests to cached commands that had to be sent, because there was no valid response in the cache */
+        uint64_t misses = 0;
+
+        /** Responses removed from the cache because a command or an event made them stale */
+        uint64_t evictions = 0;
+
+        /** Responses in the cache, including expired ones not removed yet */
+        uint64_t entries = 0;
+    };
+
+    /**
+     * Status of a watched task, see CppPTSLClient::WatchTask.
+     */
+    struct TaskStatusUpdate
+    {
+        std::string taskId;
+
+        /** TStatus_Failed also if Pro Tools doesn't know the task */
+        TaskStatus status = TaskStatus::TStatus_Queued;
+
+        /** Progress of the task in percent */
+        int32_t progress = 0;
+    };
+
     /**
      * Type of the error message which can be returned to user.
      * It can be OS error or Pro Tools error.
@@ -0,0 +1,103 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLConnectionWatcher.h
+ */
+
+#include "CppPTSLConnectionWatcher.h"
+
+#include <algorithm>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        /// Longest time the watcher sleeps between two iterations.
+        const std::chrono::milliseconds WATCH_TICK { 250 };
+
+        /// Probe interval used while the host is not ready.
+        const std::chrono::milliseconds NOT_READY_PROBE_INTERVAL { 250 };
+    } // namespace
+
+    ConnectionWatcher::ConnectionWatcher(std::shared_ptr<grpc::Channel> channel,
+        std::chrono::milliseconds probeInterval,
+        ProbeHandler probe,
+        DisconnectHandler onDisconnected,
+        TickHandler onTick)
+        : m_channel(std::move(channel)),
+          m_probeInterval(std::max(probeInterval, NOT_READY_PROBE_INTERVAL)),
+          m_probe(std::move(probe)),
+          m_onDisconnected(std::move(onDisconnected)),
+          m_onTick(std::move(onTick))
+    {
+    }
+
+    ConnectionWatcher::~ConnectionWatcher()
+    {
+        Stop();
+    }
+
+    void ConnectionWatcher::Start(bool isReady)
+    {
+        m_thread = std::thread([this, isReady]() { Run(isReady); });
+    }
+
+    void ConnectionWatcher::RequestStop()
+    {
+        m_isStopping = true;
+    }
+
+    void ConnectionWatcher::Stop()
+    {
+        RequestStop();
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    void ConnectionWatcher::RequestProbe()
+    {
+        m_isProbeRequested = true;
+    }
+
+    void ConnectionWatcher::Run(bool isReady)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point nextProbe = Clock::now() + (isReady ? m_probeInterval : NOT_READY_PROBE_INTERVAL);
+
+        while (!m_isStopping)
+        {
+            // Passing true makes an idle channel connect, so a restarted host is found without waiting for a request.
+            const grpc_connectivity_state state = m_channel->GetState(true);
+
+            if (state == GRPC_CHANNEL_TRANSIENT_FAILURE || state == GRPC_CHANNEL_SHUTDOWN)
+            {
+                if (isReady)
+                {
+                    isReady = false;
+                    m_onDisconnected();
+                }
+
+                nextProbe = std::min(nextProbe, Clock::now() + NOT_READY_PROBE_INTERVAL);
+            }
+            else if (state == GRPC_CHANNEL_READY && (Clock::now() >= nextProbe || m_isProbeRequested.exchange(false))
+                && !m_isStopping)
+            {
+                isReady = m_probe();
+                nextProbe = Clock::now() + (isReady ? m_probeInterval : NOT_READY_PROBE_INTERVAL);
+            }
+
+            m_onTick();
+
+            // Wakes up early on any state change of the channel (NotifyOnStateChange under the hood).
+            const Clock::time_point wakeUp = std::min(nextProbe, Clock::now() + WATCH_TICK);
+            m_channel->WaitForStateChange(
+                state, std::chrono::system_clock::now() + std::max<Clock::duration>(wakeUp - Clock::now(), Clock::duration::zero()));
+        }
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,95 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Background watcher of the connection to the PTSL server.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <grpcpp/grpcpp.h>
+
+namespace PTSLC_CPP
+{
+    /**
+     * Thread that follows the connectivity state of a channel and periodically probes the host.
+     *
+     * A broken connection is reported immediately. While the connection is up the host is probed
+     * every probeInterval if it was ready at the last probe, and several times per second otherwise,
+     * so a host that finished loading or came back after a restart is noticed quickly.
+     */
+    class ConnectionWatcher
+    {
+    public:
+        /**
+         * Checks whether the host is ready to execute commands. Called from the watcher thread; may block.
+         */
+        using ProbeHandler = std::function<bool()>;
+
+        /**
+         * Called from the watcher thread when the connection to the server is lost.
+         */
+        using DisconnectHandler = std::function<void()>;
+
+        /**
+         * Called from the watcher thread on every iteration, at least several times per second.
+         */
+        using TickHandler = std::function<void()>;
+
+        ConnectionWatcher(std::shared_ptr<grpc::Channel> channel,
+            std::chrono::milliseconds probeInterval,
+            ProbeHandler probe,
+            DisconnectHandler onDisconnected,
+            TickHandler onTick);
+
+        ~ConnectionWatcher();
+
+        ConnectionWatcher(const ConnectionWatcher&) = delete;
+        ConnectionWatcher& operator=(const ConnectionWatcher&) = delete;
+
+        /**
+         * Starts the watcher thread.
+         *
+         * @param isReady Readiness known from the initial probe, if it was done by the caller.
+         */
+        void Start(bool isReady);
+
+        /**
+         * Asks the watcher thread to stop without waiting for it. No probe is started afterwards.
+         */
+        void RequestStop();
+
+        /**
+         * Stops the watcher thread and waits for it.
+         */
+        void Stop();
+
+        /**
+         * Makes the watcher probe the host as soon as the connection is up, without waiting for the probe interval.
+         */
+        void RequestProbe();
+
+    private:
+        void Run(bool isReady);
+
+        std::shared_ptr<grpc::Channel> m_channel;
+        std::chrono::milliseconds m_probeInterval;
+
+        ProbeHandler m_probe;
+        DisconnectHandler m_onDisconnected;
+        TickHandler m_onTick;
+
+        std::atomic<bool> m_isStopping { false };
+        std::atomic<bool> m_isProbeRequested { false };
+        std::thread m_thread;
+    };
+} // namespace PTSLC_CPP
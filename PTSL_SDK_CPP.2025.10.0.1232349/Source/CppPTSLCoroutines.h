@@ -0,0 +1,485 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief C++20 coroutine layer on top of the callback-based PTSLC_CPP::CppPTSLClient::SendRequest.
+ *
+ * Available only when the SDK is built with the PTSLC_CPP_ENABLE_COROUTINES CMake option.
+ *
+ * @code
+ * PTSLC_CPP::Task<void> Workflow(PTSLC_CPP::CppPTSLClient& client)
+ * {
+ *     auto registration = co_await client.SendRequestAsync({ PTSLC_CPP::CommandId::CId_RegisterConnection, body });
+ *     auto trackList = co_await client.SendRequestAsync({ PTSLC_CPP::CommandId::CId_GetTrackList, "{}" });
+ *
+ *     auto stream = client.StreamRequestAsync({ PTSLC_CPP::CommandId::CId_ExportMix, exportBody });
+ *     while (auto progress = co_await stream.Next())
+ *     {
+ *         std::cout << progress->GetProgress() << std::endl;
+ *     }
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#if !defined(PTSLC_CPP_COROUTINES)
+#error "CppPTSLCoroutines.h requires the SDK to be built with PTSLC_CPP_ENABLE_COROUTINES=ON"
+#endif
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "CppPTSLClient.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Hook that decides on which thread a suspended coroutine is resumed.
+     *
+     * Without an executor coroutines are resumed inline on the client's service thread,
+     * which is the cheapest option but requires the coroutine body to never block.
+     */
+    class Executor
+    {
+    public:
+        virtual ~Executor() = default;
+
+        /**
+         * Schedules the resumption of the coroutine. Called from the client's service thread.
+         */
+        virtual void Post(std::coroutine_handle<> handle) = 0;
+    };
+
+    namespace Detail
+    {
+        inline void Resume(Executor* executor, std::coroutine_handle<> handle)
+        {
+            if (executor)
+            {
+                executor->Post(handle);
+            }
+            else
+            {
+                handle.resume();
+            }
+        }
+
+        template <class T>
+        class TaskPromiseBase
+        {
+        public:
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <class Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    auto continuation = handle.promise().m_continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept
+                {
+                }
+            };
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                m_error = std::current_exception();
+            }
+
+            std::coroutine_handle<> m_continuation;
+            std::exception_ptr m_error;
+        };
+
+        template <class T>
+        class TaskPromise : public TaskPromiseBase<T>
+        {
+        public:
+            void return_value(T value)
+            {
+                m_value.emplace(std::move(value));
+            }
+
+            T TakeResult()
+            {
+                if (this->m_error)
+                {
+                    std::rethrow_exception(this->m_error);
+                }
+
+                return std::move(*m_value);
+            }
+
+        private:
+            std::optional<T> m_value;
+        };
+
+        template <>
+        class TaskPromise<void> : public TaskPromiseBase<void>
+        {
+        public:
+            void return_void() const noexcept
+            {
+            }
+
+            void TakeResult()
+            {
+                if (this->m_error)
+                {
+                    std::rethrow_exception(this->m_error);
+                }
+            }
+        };
+
+        /**
+         * Eagerly started, self-destroying coroutine used to run a Task from non-coroutine code.
+         */
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept
+                {
+                    return {};
+                }
+
+                void return_void() const noexcept
+                {
+                }
+
+                void unhandled_exception() const noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+    } // namespace Detail
+
+    /**
+     * Lazily started coroutine that produces a value of type T.
+     * The coroutine starts when the task is awaited and resumes the awaiting coroutine when it's finished.
+     */
+    template <class T>
+    class [[nodiscard]] Task
+    {
+    public:
+        struct promise_type : public Detail::TaskPromise<T>
+        {
+            Task get_return_object() noexcept
+            {
+                return Task { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+        };
+
+        Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+        {
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return !m_handle || m_handle.done();
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            m_handle.promise().m_continuation = awaiting;
+            return m_handle;
+        }
+
+        T await_resume()
+        {
+            return m_handle.promise().TakeResult();
+        }
+
+    private:
+        explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle)
+        {
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    /**
+     * Starts the task without waiting for it. onDone (if set) receives the exception thrown by the task, if any.
+     */
+    inline void Spawn(Task<void> task, std::function<void(std::exception_ptr)> onDone = nullptr)
+    {
+        [](Task<void> task, std::function<void(std::exception_ptr)> onDone) -> Detail::DetachedTask
+        {
+            std::exception_ptr error;
+
+            try
+            {
+                co_await task;
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            if (onDone)
+            {
+                onDone(error);
+            }
+        }(std::move(task), std::move(onDone));
+    }
+
+    /**
+     * Runs the task and blocks the calling thread until it's finished.
+     * Bridges coroutine workflows into the synchronous code; never call it from the client's service thread.
+     */
+    template <class T>
+    T SyncWait(Task<T> task)
+    {
+        std::promise<T> promise;
+        std::future<T> result = promise.get_future();
+
+        [](Task<T> task, std::promise<T>& promise) -> Detail::DetachedTask
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    co_await task;
+                    promise.set_value();
+                }
+                else
+                {
+                    promise.set_value(co_await task);
+                }
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+            }
+        }(std::move(task), promise);
+
+        return result.get();
+    }
+
+    /**
+     * Awaitable returned by @ref PTSLC_CPP::CppPTSLClient::SendRequestAsync "SendRequestAsync".
+     * Sends the request when awaited and produces its final response.
+     */
+    class [[nodiscard]] RequestAwaitable
+    {
+    public:
+        RequestAwaitable(CppPTSLClient& client, CppPTSLRequest request, Executor* executor)
+            : m_client(client),
+              m_request(std::move(request)),
+              m_executor(executor)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            // The completion callback may run before SendRequest returns, so members mustn't be touched afterwards.
+            m_client.SendRequest(std::move(m_request),
+                nullptr,
+                [this, handle](const CppPTSLResponse& response)
+                {
+                    m_response = response;
+                    Detail::Resume(m_executor, handle);
+                });
+        }
+
+        CppPTSLResponse await_resume()
+        {
+            return std::move(*m_response);
+        }
+
+    private:
+        CppPTSLClient& m_client;
+        CppPTSLRequest m_request;
+        Executor* m_executor;
+        std::optional<CppPTSLResponse> m_response;
+    };
+
+    /**
+     * Async generator over all (intermediate and final) responses of a request, returned by
+     * @ref PTSLC_CPP::CppPTSLClient::StreamRequestAsync "StreamRequestAsync".
+     * The request is sent immediately; responses that arrive before they're awaited are buffered.
+     */
+    class ResponseStream
+    {
+    private:
+        struct State
+        {
+            std::mutex m_mutex;
+            std::deque<CppPTSLResponse> m_pending;
+            std::optional<CppPTSLResponse> m_result;
+            std::coroutine_handle<> m_waiter;
+            Executor* m_executor = nullptr;
+        };
+
+    public:
+        class NextAwaitable
+        {
+        public:
+            explicit NextAwaitable(std::shared_ptr<State> state) : m_state(std::move(state))
+            {
+            }
+
+            bool await_ready() const
+            {
+                std::lock_guard<std::mutex> lock(m_state->m_mutex);
+                return !m_state->m_pending.empty() || m_state->m_result;
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                std::lock_guard<std::mutex> lock(m_state->m_mutex);
+
+                if (!m_state->m_pending.empty() || m_state->m_result)
+                {
+                    return false;
+                }
+
+                m_state->m_waiter = handle;
+                return true;
+            }
+
+            std::optional<CppPTSLResponse> await_resume()
+            {
+                std::lock_guard<std::mutex> lock(m_state->m_mutex);
+
+                if (m_state->m_pending.empty())
+                {
+                    return std::nullopt;
+                }
+
+                CppPTSLResponse response = std::move(m_state->m_pending.front());
+                m_state->m_pending.pop_front();
+                return response;
+            }
+
+        private:
+            std::shared_ptr<State> m_state;
+        };
+
+        ResponseStream(CppPTSLClient& client, CppPTSLRequest request, Executor* executor)
+            : m_state(std::make_shared<State>())
+        {
+            m_state->m_executor = executor;
+
+            client.SendRequest(
+                std::move(request),
+                [state = m_state](const CppPTSLResponse& response)
+                { Publish(*state, [&]() { state->m_pending.push_back(response); }); },
+                [state = m_state](const CppPTSLResponse& response)
+                { Publish(*state, [&]() { state->m_result = response; }); });
+        }
+
+        /**
+         * Produces the next response, or an empty optional once the request is finished.
+         */
+        NextAwaitable Next() const
+        {
+            return NextAwaitable { m_state };
+        }
+
+        /**
+         * Final response of the request (the same one SendRequest's future would return).
+         * Available after Next() produced an empty optional.
+         */
+        std::optional<CppPTSLResponse> Result() const
+        {
+            std::lock_guard<std::mutex> lock(m_state->m_mutex);
+            return m_state->m_result;
+        }
+
+    private:
+        template <class Update>
+        static void Publish(State& state, Update&& update)
+        {
+            std::coroutine_handle<> waiter;
+
+            {
+                std::lock_guard<std::mutex> lock(state.m_mutex);
+                update();
+                waiter = std::exchange(state.m_waiter, nullptr);
+            }
+
+            if (waiter)
+            {
+                Detail::Resume(state.m_executor, waiter);
+            }
+        }
+
+        std::shared_ptr<State> m_state;
+    };
+
+    inline RequestAwaitable CppPTSLClient::SendRequestAsync(CppPTSLRequest request, Executor* executor)
+    {
+        return RequestAwaitable { *this, std::move(request), executor };
+    }
+
+    inline ResponseStream CppPTSLClient::StreamRequestAsync(CppPTSLRequest request, Executor* executor)
+    {
+        return ResponseStream { *this, std::move(request), executor };
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,216 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLJsonBuilder.h
+ */
+
+#include "CppPTSLJsonBuilder.h"
+
+#include <algorithm>
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        constexpr uint64_t ONES = 0x0101010101010101ull;
+        constexpr uint64_t HIGH_BITS = 0x8080808080808080ull;
+
+        /**
+         * Returns whether any of the 8 bytes is a quote, a backslash or a control character.
+         */
+        bool NeedsEscape(uint64_t bytes)
+        {
+            const uint64_t quotes = bytes ^ (ONES * '"');
+            const uint64_t backslashes = bytes ^ (ONES * '\\');
+
+            // a byte b is below n if b - n borrows while the high bit of b is clear
+            const uint64_t controls = (bytes - ONES * 0x20) & ~bytes;
+            const uint64_t zeros = ((quotes - ONES) & ~quotes) | ((backslashes - ONES) & ~backslashes);
+
+            return ((controls | zeros) & HIGH_BITS) != 0;
+        }
+
+        /**
+         * Returns the length of the beginning of the text that can be copied as is.
+         */
+        size_t FindEscape(const char* text, size_t size)
+        {
+            size_t i = 0;
+
+            for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+            {
+                uint64_t bytes;
+                std::memcpy(&bytes, text + i, sizeof(bytes));
+
+                if (NeedsEscape(bytes))
+                {
+                    break;
+                }
+            }
+
+            for (; i < size; ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(text[i]);
+
+                if (c < 0x20 || c == '"' || c == '\\')
+                {
+                    break;
+                }
+            }
+
+            return i;
+        }
+
+        void AppendEscaped(std::string& json, char c)
+        {
+            static const char HEX_DIGITS[] = "0123456789abcdef";
+
+            switch (c)
+            {
+                case '"':
+                    json += "\\\"";
+                    break;
+                case '\\':
+                    json += "\\\\";
+                    break;
+                case '\b':
+                    json += "\\b";
+                    break;
+                case '\f':
+                    json += "\\f";
+                    break;
+                case '\n':
+                    json += "\\n";
+                    break;
+                case '\r':
+                    json += "\\r";
+                    break;
+                case '\t':
+                    json += "\\t";
+                    break;
+                default:
+                    json += "\\u00";
+                    json += HEX_DIGITS[(c >> 4) & 0xF];
+                    json += HEX_DIGITS[c & 0xF];
+            }
+        }
+
+        template <typename Integer>
+        void AppendInteger(std::string& json, Integer value)
+        {
+            char buffer[24];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            json.append(buffer, result.ptr);
+        }
+
+        /**
+         * Appends the shortest text that reads back as the same number, or a non-finite number as a string.
+         */
+        template <typename Number>
+        void AppendNumber(std::string& json, Number value, int minPrecision, int maxPrecision)
+        {
+            if (std::isnan(value))
+            {
+                json += "\"NaN\"";
+                return;
+            }
+
+            if (std::isinf(value))
+            {
+                json += value < 0 ? "\"-Infinity\"" : "\"Infinity\"";
+                return;
+            }
+
+            char buffer[32];
+            int length = 0;
+
+            for (int precision = minPrecision; precision <= maxPrecision; ++precision)
+            {
+                length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(value));
+
+                if (static_cast<Number>(std::strtod(buffer, nullptr)) == value)
+                {
+                    break;
+                }
+            }
+
+            // snprintf and strtod use the decimal separator of the current locale
+            const char decimalPoint = *std::localeconv()->decimal_point;
+
+            if (decimalPoint != '.')
+            {
+                std::replace(buffer, buffer + length, decimalPoint, '.');
+            }
+
+            json.append(buffer, static_cast<size_t>(length));
+        }
+    } // namespace
+
+    void AppendJsonValue(std::string& json, std::string_view value)
+    {
+        json += '"';
+
+        while (!value.empty())
+        {
+            const size_t plain = FindEscape(value.data(), value.size());
+            json.append(value.data(), plain);
+
+            if (plain == value.size())
+            {
+                break;
+            }
+
+            AppendEscaped(json, value[plain]);
+            value.remove_prefix(plain + 1);
+        }
+
+        json += '"';
+    }
+
+    void AppendJsonValue(std::string& json, bool value)
+    {
+        json += value ? "true" : "false";
+    }
+
+    void AppendJsonValue(std::string& json, int32_t value)
+    {
+        AppendInteger(json, value);
+    }
+
+    void AppendJsonValue(std::string& json, uint32_t value)
+    {
+        AppendInteger(json, value);
+    }
+
+    void AppendJsonValue(std::string& json, int64_t value)
+    {
+        json += '"';
+        AppendInteger(json, value);
+        json += '"';
+    }
+
+    void AppendJsonValue(std::string& json, uint64_t value)
+    {
+        json += '"';
+        AppendInteger(json, value);
+        json += '"';
+    }
+
+    void AppendJsonValue(std::string& json, float value)
+    {
+        AppendNumber(json, value, 6, 9);
+    }
+
+    void AppendJsonValue(std::string& json, double value)
+    {
+        AppendNumber(json, value, 15, 17);
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,176 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Base class of the generated request body builders of CppPTSLRequestBodies.h.
+ *
+ * See CppPTSLJsonBuilder.cpp to view all initialization details.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "PtslCCppExport.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Appends the JSON value to the text. Strings are escaped and expected to be UTF-8;
+     * 64-bit integers are quoted and non-finite numbers are written as "NaN", "Infinity" and "-Infinity",
+     * like protobuf does.
+     */
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, std::string_view value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, bool value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, int32_t value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, uint32_t value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, int64_t value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, uint64_t value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, float value);
+    PTSLC_CPP_EXPORT void AppendJsonValue(std::string& json, double value);
+
+    /**
+     * Writes a JSON object field by field straight into a string, without building a document first.
+     *
+     * The object is kept complete after every call, so the text can be sent at any time.
+     * The fields are written in the order they are set; setting a field twice writes it twice.
+     */
+    class PTSLC_CPP_EXPORT CppPTSLJsonBuilder
+    {
+    public:
+        CppPTSLJsonBuilder(const CppPTSLJsonBuilder&) = delete;
+        CppPTSLJsonBuilder& operator=(const CppPTSLJsonBuilder&) = delete;
+
+        /**
+         * Returns the whole text the object is written to.
+         */
+        const std::string& GetJson() const
+        {
+            return *mJson;
+        }
+
+    protected:
+        /**
+         * Writes the object to a string of its own.
+         */
+        CppPTSLJsonBuilder() : mJson(&mOwnJson)
+        {
+            mOwnJson = "{}";
+        }
+
+        /**
+         * Writes the object at the end of the json. Cleared and reused for each body, the string
+         * keeps its capacity, so the bodies are built without allocating.
+         */
+        explicit CppPTSLJsonBuilder(std::string& json) : mJson(&json)
+        {
+            json += "{}";
+        }
+
+        template <typename Value>
+        void WriteField(std::string_view key, const Value& value)
+        {
+            std::string& json = BeginField(key);
+            AppendJsonValue(json, value);
+            EndField();
+        }
+
+        /**
+         * Writes an array of the values of the range, each converted to Element.
+         */
+        template <typename Element, typename Range>
+        void WriteArray(std::string_view key, const Range& values)
+        {
+            std::string& json = BeginField(key);
+            json += '[';
+
+            for (const auto& value : values)
+            {
+                AppendJsonValue(json, Element { value });
+                json += ',';
+            }
+
+            CloseArray(json);
+            EndField();
+        }
+
+        /**
+         * Writes the object that fill(Builder&) sets the fields of.
+         */
+        template <typename Builder, typename Fill>
+        void WriteObject(std::string_view key, Fill&& fill)
+        {
+            std::string& json = BeginField(key);
+            Builder builder(json);
+            fill(builder);
+            EndField();
+        }
+
+        /**
+         * Writes an array of one object for each item of the range, which fill(Builder&, item) sets the fields of.
+         */
+        template <typename Builder, typename Range, typename Fill>
+        void WriteObjectArray(std::string_view key, const Range& items, Fill&& fill)
+        {
+            std::string& json = BeginField(key);
+            json += '[';
+
+            for (const auto& item : items)
+            {
+                Builder builder(json);
+                fill(builder, item);
+                json += ',';
+            }
+
+            CloseArray(json);
+            EndField();
+        }
+
+    private:
+        /**
+         * Reopens the object for the field with the key, which needs no escaping, and returns the text to write
+         * its value to.
+         */
+        std::string& BeginField(std::string_view key)
+        {
+            std::string& json = *mJson;
+            json.pop_back();
+
+            if (json.back() != '{')
+            {
+                json += ',';
+            }
+
+            json += '"';
+            json += key;
+            json += "\":";
+            return json;
+        }
+
+        void EndField()
+        {
+            *mJson += '}';
+        }
+
+        /**
+         * Replaces the comma after the last element, if any, with the closing bracket.
+         */
+        static void CloseArray(std::string& json)
+        {
+            if (json.back() == ',')
+            {
+                json.back() = ']';
+            }
+            else
+            {
+                json += ']';
+            }
+        }
+
+        std::string mOwnJson;
+        std::string* mJson;
+    };
+} // namespace PTSLC_CPP
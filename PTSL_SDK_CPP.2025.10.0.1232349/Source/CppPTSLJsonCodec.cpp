@@ -0,0 +1,1234 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLJsonCodec.h
+ */
+
+#include "CppPTSLJsonCodec.h"
+#include "CppPTSLJsonScanner.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        /// Below the recursion limit of the reflective parser.
+        constexpr int32_t MAX_DEPTH = 64;
+
+        bool IsWhitespace(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        /**
+         * Returns the length of the well-formed UTF-8 sequence at position and its code point, or 0 if it's malformed.
+         */
+        size_t DecodeUtf8(const char* position, const char* end, uint32_t& codePoint)
+        {
+            const auto byte = [position](size_t index) { return static_cast<unsigned char>(position[index]); };
+            const size_t available = static_cast<size_t>(end - position);
+            const unsigned char first = byte(0);
+
+            if (first < 0x80)
+            {
+                codePoint = first;
+                return 1;
+            }
+
+            size_t length = 0;
+            unsigned char low = 0x80;
+            unsigned char high = 0xBF;
+
+            if (first >= 0xC2 && first <= 0xDF)
+            {
+                length = 2;
+                codePoint = first & 0x1F;
+            }
+            else if (first >= 0xE0 && first <= 0xEF)
+            {
+                length = 3;
+                codePoint = first & 0x0F;
+                low = first == 0xE0 ? 0xA0 : 0x80;
+                high = first == 0xED ? 0x9F : 0xBF;
+            }
+            else if (first >= 0xF0 && first <= 0xF4)
+            {
+                length = 4;
+                codePoint = first & 0x07;
+                low = first == 0xF0 ? 0x90 : 0x80;
+                high = first == 0xF4 ? 0x8F : 0xBF;
+            }
+            else
+            {
+                return 0;
+            }
+
+            if (available < length || byte(1) < low || byte(1) > high)
+            {
+                return 0;
+            }
+
+            for (size_t i = 1; i < length; ++i)
+            {
+                if ((byte(i) & 0xC0) != 0x80)
+                {
+                    return 0;
+                }
+
+                codePoint = (codePoint << 6) | (byte(i) & 0x3F);
+            }
+
+            return length;
+        }
+
+        void AppendUtf8(std::string& output, uint32_t codePoint)
+        {
+            if (codePoint < 0x80)
+            {
+                output += static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                output += static_cast<char>(0xC0 | (codePoint >> 6));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else if (codePoint < 0x10000)
+            {
+                output += static_cast<char>(0xE0 | (codePoint >> 12));
+                output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+            else
+            {
+                output += static_cast<char>(0xF0 | (codePoint >> 18));
+                output += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                output += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output += static_cast<char>(0x80 | (codePoint & 0x3F));
+            }
+        }
+
+        bool ReadHex4(const char* position, const char* end, uint32_t& value)
+        {
+            if (end - position < 4)
+            {
+                return false;
+            }
+
+            value = 0;
+
+            for (int32_t i = 0; i < 4; ++i)
+            {
+                const char c = position[i];
+                value <<= 4;
+
+                if (IsDigit(c))
+                {
+                    value |= static_cast<uint32_t>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f')
+                {
+                    value |= static_cast<uint32_t>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F')
+                {
+                    value |= static_cast<uint32_t>(c - 'A' + 10);
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Code points besides the ASCII control characters that the reflective printer escapes.
+         */
+        bool IsEscapedCodePoint(uint32_t codePoint)
+        {
+            return (codePoint >= 0x7F && codePoint <= 0x9F) || codePoint == 0xAD
+                || (codePoint >= 0x600 && codePoint <= 0x603) || codePoint == 0x6DD || codePoint == 0x70F
+                || (codePoint >= 0x17B4 && codePoint <= 0x17B5) || (codePoint >= 0x200B && codePoint <= 0x200F)
+                || (codePoint >= 0x2028 && codePoint <= 0x202E) || (codePoint >= 0x2060 && codePoint <= 0x2064)
+                || (codePoint >= 0x206A && codePoint <= 0x206F) || codePoint == 0xFEFF
+                || (codePoint >= 0xFFF9 && codePoint <= 0xFFFB) || (codePoint >= 0x1D173 && codePoint <= 0x1D17A)
+                || codePoint == 0xE0001 || (codePoint >= 0xE0020 && codePoint <= 0xE007F);
+        }
+
+        void AppendUnicodeEscape(std::string& output, uint32_t unit)
+        {
+            static const char digits[] = "0123456789abcdef";
+
+            output += "\\u";
+            output += digits[(unit >> 12) & 0xF];
+            output += digits[(unit >> 8) & 0xF];
+            output += digits[(unit >> 4) & 0xF];
+            output += digits[unit & 0xF];
+        }
+
+        /**
+         * The decimal separator of the current locale, as printf writes it, replaced with a point.
+         */
+        void DelocalizeRadix(char* buffer)
+        {
+            for (char* c = buffer; *c != '\0'; ++c)
+            {
+                if (*c == ',')
+                {
+                    *c = '.';
+                }
+            }
+        }
+
+        template <typename Integer>
+        void AppendInteger(std::string& output, Integer value)
+        {
+            char buffer[24];
+            auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+            output.append(buffer, result.ptr);
+        }
+
+        bool ParseListElement(std::string_view json,
+            google::protobuf::Message* element,
+            const google::protobuf::util::JsonParseOptions& options)
+        {
+            element->Clear();
+
+            if (const GeneratedJsonCodec* codec = FindGeneratedJsonCodec(element->GetDescriptor()))
+            {
+                JsonReader reader(json, options.ignore_unknown_fields);
+
+                if (codec->m_read(reader, *element) && reader.IsAtEnd())
+                {
+                    return true;
+                }
+
+                element->Clear();
+            }
+
+            return google::protobuf::util::JsonStringToMessage(std::string { json }, element, options).ok();
+        }
+
+        /**
+         * Passes the elements of the list at p to onElement, counting them in passedCount.
+         */
+        bool StreamListElements(JsonScanner::Position& p,
+            JsonScanner::Position end,
+            google::protobuf::Message* element,
+            const google::protobuf::util::JsonParseOptions& options,
+            const std::function<void(const google::protobuf::Message& element)>& onElement,
+            int& passedCount)
+        {
+            if (JsonScanner::ScalarToken(p, end) == "null")
+            {
+                p += 4;
+                return true;
+            }
+
+            if (!JsonScanner::Consume(p, end, '['))
+            {
+                return false;
+            }
+
+            if (p != end && *p == ']')
+            {
+                ++p;
+                return true;
+            }
+
+            while (true)
+            {
+                const JsonScanner::Position value = p;
+
+                if (!JsonScanner::SkipValue(p, end)
+                    || !ParseListElement(std::string_view(value, static_cast<size_t>(p - value)), element, options))
+                {
+                    return false;
+                }
+
+                onElement(*element);
+                ++passedCount;
+
+                JsonScanner::SkipWhitespace(p, end);
+
+                if (p != end && *p == ']')
+                {
+                    ++p;
+                    return true;
+                }
+
+                if (!JsonScanner::Consume(p, end, ','))
+                {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * Walks the body once, passing the elements of the list to onElement and collecting the other fields
+         * into otherFieldsJson. Returns false if the body has to be left to ParseJsonBody.
+         */
+        bool StreamListBody(const std::string& json,
+            const google::protobuf::FieldDescriptor* listField,
+            google::protobuf::Message* element,
+            const google::protobuf::util::JsonParseOptions& options,
+            const std::function<void(const google::protobuf::Message& element)>& onElement,
+            int& passedCount,
+            std::string& otherFieldsJson)
+        {
+            JsonScanner::Position p = json.data();
+            const JsonScanner::Position end = p + json.size();
+            bool hasList = false;
+
+            otherFieldsJson = "{";
+
+            if (!JsonScanner::Consume(p, end, '{'))
+            {
+                return false;
+            }
+
+            if (p != end && *p == '}')
+            {
+                ++p;
+            }
+            else
+            {
+                while (true)
+                {
+                    const JsonScanner::Position member = p;
+                    std::string_view key;
+
+                    if (p == end || *p != '"' || !JsonScanner::SkipString(p, end, key)
+                        || !JsonScanner::Consume(p, end, ':'))
+                    {
+                        return false;
+                    }
+
+                    if (JsonScanner::KeyEquals(key, listField->name()) || JsonScanner::KeyEquals(key, listField->json_name()))
+                    {
+                        // which of the duplicates counts is up to the reflective parser
+                        if (hasList || !StreamListElements(p, end, element, options, onElement, passedCount))
+                        {
+                            return false;
+                        }
+
+                        hasList = true;
+                    }
+                    else
+                    {
+                        if (!JsonScanner::SkipValue(p, end))
+                        {
+                            return false;
+                        }
+
+                        if (otherFieldsJson.size() > 1)
+                        {
+                            otherFieldsJson += ',';
+                        }
+
+                        otherFieldsJson.append(member, p);
+                    }
+
+                    JsonScanner::SkipWhitespace(p, end);
+
+                    if (p != end && *p == '}')
+                    {
+                        ++p;
+                        break;
+                    }
+
+                    if (!JsonScanner::Consume(p, end, ','))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            JsonScanner::SkipWhitespace(p, end);
+            otherFieldsJson += '}';
+
+            return p == end;
+        }
+    } // namespace
+
+    JsonStatus ParseJsonBody(const std::string& json,
+        google::protobuf::Message* message,
+        const google::protobuf::util::JsonParseOptions& options)
+    {
+        if (const GeneratedJsonCodec* codec = FindGeneratedJsonCodec(message->GetDescriptor()))
+        {
+            message->Clear();
+
+            JsonReader reader(json, options.ignore_unknown_fields);
+
+            if (codec->m_read(reader, *message) && reader.IsAtEnd())
+            {
+                return JsonStatus();
+            }
+
+            message->Clear();
+        }
+
+        return google::protobuf::util::JsonStringToMessage(json, message, options);
+    }
+
+    JsonStatus PrintJsonBody(const google::protobuf::Message& message,
+        std::string* json,
+        const google::protobuf::util::JsonOptions& options)
+    {
+#if GOOGLE_PROTOBUF_VERSION < 5026000
+        const bool printDefaults = options.always_print_primitive_fields;
+#else
+        const bool printDefaults = options.always_print_fields_with_no_presence;
+#endif
+
+        const GeneratedJsonCodec* codec = FindGeneratedJsonCodec(message.GetDescriptor());
+
+        if (codec && options.preserve_proto_field_names && !options.always_print_enums_as_ints)
+        {
+            const size_t initialSize = json->size();
+            JsonWriter writer(*json, options.add_whitespace, printDefaults);
+
+            codec->m_write(writer, message);
+
+            if (writer.IsValid())
+            {
+                if (options.add_whitespace)
+                {
+                    *json += '\n';
+                }
+
+                return JsonStatus();
+            }
+
+            json->resize(initialSize);
+        }
+
+        std::string reflectiveJson;
+        JsonStatus status = google::protobuf::util::MessageToJsonString(message, &reflectiveJson, options);
+        json->append(reflectiveJson);
+        return status;
+    }
+
+    JsonStatus ParseJsonListBody(const std::string& json,
+        google::protobuf::Message* body,
+        const google::protobuf::FieldDescriptor* listField,
+        google::protobuf::Message* element,
+        const google::protobuf::util::JsonParseOptions& options,
+        const std::function<void(const google::protobuf::Message& element)>& onElement)
+    {
+        int passedCount = 0;
+        std::string otherFieldsJson;
+
+        if (StreamListBody(json, listField, element, options, onElement, passedCount, otherFieldsJson))
+        {
+            JsonStatus status = ParseJsonBody(otherFieldsJson, body, options);
+
+            if (status.ok())
+            {
+                return status;
+            }
+        }
+
+        JsonStatus status = ParseJsonBody(json, body, options);
+
+        if (status.ok())
+        {
+            const google::protobuf::Reflection* reflection = body->GetReflection();
+
+            for (int i = passedCount; i < reflection->FieldSize(*body, listField); ++i)
+            {
+                onElement(reflection->GetRepeatedMessage(*body, listField, i));
+            }
+
+            reflection->ClearField(body, listField);
+        }
+
+        return status;
+    }
+
+    JsonReader::JsonReader(std::string_view json, bool ignoreUnknownFields)
+        : m_position(json.data()),
+          m_end(json.data() + json.size()),
+          m_ignoreUnknownFields(ignoreUnknownFields)
+    {
+    }
+
+    bool JsonReader::Read(std::string& value)
+    {
+        SkipWhitespace();
+
+        if (m_position == m_end || *m_position != '"')
+        {
+            return false;
+        }
+
+        ++m_position;
+        value.clear();
+
+        while (m_position != m_end)
+        {
+            const char* run = m_position;
+
+            while (m_position != m_end && *m_position != '"' && *m_position != '\\'
+                && static_cast<unsigned char>(*m_position) >= 0x20 && static_cast<unsigned char>(*m_position) < 0x80)
+            {
+                ++m_position;
+            }
+
+            value.append(run, m_position);
+
+            if (m_position == m_end)
+            {
+                return false;
+            }
+
+            const unsigned char c = static_cast<unsigned char>(*m_position);
+
+            if (c == '"')
+            {
+                ++m_position;
+                return true;
+            }
+
+            if (c >= 0x80)
+            {
+                uint32_t codePoint = 0;
+                const size_t length = DecodeUtf8(m_position, m_end, codePoint);
+
+                if (length == 0)
+                {
+                    return false;
+                }
+
+                value.append(m_position, length);
+                m_position += length;
+                continue;
+            }
+
+            // Unescaped control characters are left to the reflective parser.
+            if (c != '\\' || m_end - m_position < 2)
+            {
+                return false;
+            }
+
+            const char escaped = m_position[1];
+            m_position += 2;
+
+            switch (escaped)
+            {
+                case '"':
+                case '\\':
+                case '/':
+                    value += escaped;
+                    break;
+                case 'b':
+                    value += '\b';
+                    break;
+                case 'f':
+                    value += '\f';
+                    break;
+                case 'n':
+                    value += '\n';
+                    break;
+                case 'r':
+                    value += '\r';
+                    break;
+                case 't':
+                    value += '\t';
+                    break;
+                case 'u':
+                {
+                    uint32_t codePoint = 0;
+
+                    if (!ReadHex4(m_position, m_end, codePoint))
+                    {
+                        return false;
+                    }
+
+                    m_position += 4;
+
+                    if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+                    {
+                        return false;
+                    }
+
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        uint32_t low = 0;
+
+                        if (m_end - m_position < 6 || m_position[0] != '\\' || m_position[1] != 'u'
+                            || !ReadHex4(m_position + 2, m_end, low) || low < 0xDC00 || low > 0xDFFF)
+                        {
+                            return false;
+                        }
+
+                        m_position += 6;
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                    }
+
+                    AppendUtf8(value, codePoint);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        return false;
+    }
+
+    bool JsonReader::Read(bool& value)
+    {
+        SkipWhitespace();
+
+        const std::string_view rest(m_position, static_cast<size_t>(m_end - m_position));
+
+        if (rest.substr(0, 4) == "true")
+        {
+            m_position += 4;
+            value = true;
+        }
+        else if (rest.substr(0, 5) == "false")
+        {
+            m_position += 5;
+            value = false;
+        }
+        else
+        {
+            return false;
+        }
+
+        // e.g. "trueish"
+        return m_position == m_end || !std::isalnum(static_cast<unsigned char>(*m_position));
+    }
+
+    bool JsonReader::Read(int32_t& value)
+    {
+        return ReadInteger(value);
+    }
+
+    bool JsonReader::Read(uint32_t& value)
+    {
+        return ReadInteger(value);
+    }
+
+    bool JsonReader::Read(int64_t& value)
+    {
+        return ReadInteger(value);
+    }
+
+    bool JsonReader::Read(uint64_t& value)
+    {
+        return ReadInteger(value);
+    }
+
+    bool JsonReader::Read(float& value)
+    {
+        return ReadFloating(value);
+    }
+
+    bool JsonReader::Read(double& value)
+    {
+        return ReadFloating(value);
+    }
+
+    bool JsonReader::ReadEnumName(std::string_view& name)
+    {
+        SkipWhitespace();
+
+        if (m_position == m_end || *m_position != '"')
+        {
+            return false;
+        }
+
+        const char* begin = ++m_position;
+
+        while (m_position != m_end && *m_position != '"')
+        {
+            const char c = *m_position;
+
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            {
+                return false;
+            }
+
+            ++m_position;
+        }
+
+        if (m_position == m_end)
+        {
+            return false;
+        }
+
+        name = std::string_view(begin, static_cast<size_t>(m_position - begin));
+        ++m_position;
+        return true;
+    }
+
+    bool JsonReader::IsString()
+    {
+        SkipWhitespace();
+        return m_position != m_end && *m_position == '"';
+    }
+
+    bool JsonReader::SkipUnknownValue()
+    {
+        return m_ignoreUnknownFields && SkipValue();
+    }
+
+    bool JsonReader::IsAtEnd()
+    {
+        SkipWhitespace();
+        return m_position == m_end;
+    }
+
+    void JsonReader::SkipWhitespace()
+    {
+        while (m_position != m_end && IsWhitespace(*m_position))
+        {
+            ++m_position;
+        }
+    }
+
+    bool JsonReader::Consume(char c)
+    {
+        SkipWhitespace();
+
+        if (m_position != m_end && *m_position == c)
+        {
+            ++m_position;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool JsonReader::Enter(char c)
+    {
+        return Consume(c) && ++m_depth <= MAX_DEPTH;
+    }
+
+    bool JsonReader::Leave()
+    {
+        --m_depth;
+        return true;
+    }
+
+    bool JsonReader::ReadKey(std::string_view& key)
+    {
+        SkipWhitespace();
+
+        if (m_position == m_end || *m_position != '"')
+        {
+            return false;
+        }
+
+        const char* begin = ++m_position;
+
+        while (m_position != m_end && *m_position != '"')
+        {
+            const unsigned char c = static_cast<unsigned char>(*m_position);
+
+            if (c == '\\' || c < 0x20)
+            {
+                return false;
+            }
+
+            if (c >= 0x80)
+            {
+                uint32_t codePoint = 0;
+                const size_t length = DecodeUtf8(m_position, m_end, codePoint);
+
+                if (length == 0)
+                {
+                    return false;
+                }
+
+                m_position += length;
+                continue;
+            }
+
+            ++m_position;
+        }
+
+        // The reflective parser rejects empty keys.
+        if (m_position == m_end || m_position == begin)
+        {
+            return false;
+        }
+
+        key = std::string_view(begin, static_cast<size_t>(m_position - begin));
+        ++m_position;
+        return Consume(':');
+    }
+
+    bool JsonReader::ReadNumberToken(std::string_view& token)
+    {
+        SkipWhitespace();
+
+        const char* begin = m_position;
+        const auto digits = [this]() {
+            const char* first = m_position;
+
+            while (m_position != m_end && IsDigit(*m_position))
+            {
+                ++m_position;
+            }
+
+            return m_position != first;
+        };
+
+        if (m_position != m_end && *m_position == '-')
+        {
+            ++m_position;
+        }
+
+        // No leading zeros, the reflective parser takes them for octal numbers.
+        if (m_position != m_end && *m_position == '0')
+        {
+            ++m_position;
+        }
+        else if (!digits())
+        {
+            return false;
+        }
+
+        if (m_position != m_end && *m_position == '.')
+        {
+            ++m_position;
+
+            if (!digits())
+            {
+                return false;
+            }
+        }
+
+        if (m_position != m_end && (*m_position == 'e' || *m_position == 'E'))
+        {
+            ++m_position;
+
+            if (m_position != m_end && (*m_position == '+' || *m_position == '-'))
+            {
+                ++m_position;
+            }
+
+            if (!digits())
+            {
+                return false;
+            }
+        }
+
+        if (m_position != m_end && (std::isalnum(static_cast<unsigned char>(*m_position)) || *m_position == '.'))
+        {
+            return false;
+        }
+
+        token = std::string_view(begin, static_cast<size_t>(m_position - begin));
+        return true;
+    }
+
+    template <typename Integer>
+    bool JsonReader::ReadInteger(Integer& value)
+    {
+        std::string_view token;
+
+        // Integers may be quoted, 64-bit ones always are.
+        if (IsString())
+        {
+            const char* begin = ++m_position;
+
+            while (m_position != m_end && *m_position != '"')
+            {
+                ++m_position;
+            }
+
+            if (m_position == m_end)
+            {
+                return false;
+            }
+
+            token = std::string_view(begin, static_cast<size_t>(m_position - begin));
+            ++m_position;
+
+            const std::string_view digits = token.substr(token.empty() || token[0] != '-' ? 0 : 1);
+
+            if (digits.empty() || (digits[0] == '0' && digits.size() > 1))
+            {
+                return false;
+            }
+        }
+        else if (!ReadNumberToken(token))
+        {
+            return false;
+        }
+
+        // Fractions and exponents, e.g. 5.0 or 5e0, are left to the reflective parser.
+        auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+        return result.ec == std::errc() && result.ptr == token.data() + token.size();
+    }
+
+    template <typename Floating>
+    bool JsonReader::ReadFloating(Floating& value)
+    {
+        std::string_view token;
+
+        // Quoted values, e.g. "NaN", are left to the reflective parser.
+        if (!ReadNumberToken(token) || token.size() >= 64)
+        {
+            return false;
+        }
+
+        // The reflective parser converts large integers exactly, don't risk rounding them differently.
+        const bool isInteger = token.find_first_of(".eE") == std::string_view::npos;
+
+        if (isInteger && token.size() > 15)
+        {
+            return false;
+        }
+
+        char buffer[64];
+        std::memcpy(buffer, token.data(), token.size());
+        buffer[token.size()] = '\0';
+
+        char* parsedEnd = nullptr;
+        const double parsed = std::strtod(buffer, &parsedEnd);
+
+        // The decimal separator of the locale isn't a point, or the value is out of range.
+        if (parsedEnd != buffer + token.size() || !std::isfinite(parsed))
+        {
+            return false;
+        }
+
+        // An integer is converted as such, so -0 is a positive zero.
+        if (isInteger && parsed == 0)
+        {
+            value = 0;
+            return true;
+        }
+
+        if constexpr (std::is_same_v<Floating, float>)
+        {
+            if (parsed > FLT_MAX || parsed < -FLT_MAX || (isInteger && std::fabs(parsed) > 16777216.0))
+            {
+                return false;
+            }
+        }
+
+        value = static_cast<Floating>(parsed);
+        return true;
+    }
+
+    bool JsonReader::SkipValue()
+    {
+        SkipWhitespace();
+
+        if (m_position == m_end)
+        {
+            return false;
+        }
+
+        switch (*m_position)
+        {
+            case '{':
+                return ReadObject([this](std::string_view) { return SkipValue(); });
+            case '[':
+                return ReadArray([this]() { return SkipValue(); });
+            case '"':
+                return SkipString();
+            case 't':
+            case 'f':
+            {
+                bool value = false;
+                return Read(value);
+            }
+            case 'n':
+            {
+                const std::string_view rest(m_position, static_cast<size_t>(m_end - m_position));
+
+                if (rest.substr(0, 4) != "null")
+                {
+                    return false;
+                }
+
+                m_position += 4;
+                return m_position == m_end || !std::isalnum(static_cast<unsigned char>(*m_position));
+            }
+            default:
+            {
+                // The reflective parser rejects numbers out of the range of double even if it skips them.
+                double value = 0;
+                return ReadFloating(value);
+            }
+        }
+    }
+
+    bool JsonReader::SkipString()
+    {
+        std::string value;
+        return Read(value);
+    }
+
+    JsonWriter::JsonWriter(std::string& output, bool addWhitespace, bool printDefaults)
+        : m_output(output),
+          m_addWhitespace(addWhitespace),
+          m_printDefaults(printDefaults)
+    {
+    }
+
+    void JsonWriter::BeginObject()
+    {
+        m_output += '{';
+        m_hasMembers.push_back(false);
+    }
+
+    void JsonWriter::EndObject()
+    {
+        const bool hasMembers = m_hasMembers.back();
+        m_hasMembers.pop_back();
+
+        if (hasMembers)
+        {
+            NewLine();
+        }
+
+        m_output += '}';
+    }
+
+    void JsonWriter::BeginArray()
+    {
+        m_output += '[';
+        m_hasMembers.push_back(false);
+    }
+
+    void JsonWriter::EndArray()
+    {
+        const bool hasMembers = m_hasMembers.back();
+        m_hasMembers.pop_back();
+
+        if (hasMembers)
+        {
+            NewLine();
+        }
+
+        m_output += ']';
+    }
+
+    void JsonWriter::Key(std::string_view key)
+    {
+        NextElement();
+        m_output += '"';
+        m_output += key;
+        m_output += m_addWhitespace ? "\": " : "\":";
+    }
+
+    void JsonWriter::NextElement()
+    {
+        if (m_hasMembers.back())
+        {
+            m_output += ',';
+        }
+
+        m_hasMembers.back() = true;
+        NewLine();
+    }
+
+    void JsonWriter::Write(const std::string& value)
+    {
+        m_output += '"';
+
+        const char* position = value.data();
+        const char* end = value.data() + value.size();
+
+        while (position != end)
+        {
+            const char* run = position;
+
+            while (position != end)
+            {
+                const unsigned char c = static_cast<unsigned char>(*position);
+
+                if (c < 0x20 || c >= 0x7F || c == '"' || c == '\\' || c == '<' || c == '>')
+                {
+                    break;
+                }
+
+                ++position;
+            }
+
+            m_output.append(run, position);
+
+            if (position == end)
+            {
+                break;
+            }
+
+            uint32_t codePoint = 0;
+            const size_t length = DecodeUtf8(position, end, codePoint);
+
+            if (length == 0)
+            {
+                m_isValid = false;
+                return;
+            }
+
+            switch (codePoint)
+            {
+                case '"':
+                    m_output += "\\\"";
+                    break;
+                case '\\':
+                    m_output += "\\\\";
+                    break;
+                case '\b':
+                    m_output += "\\b";
+                    break;
+                case '\f':
+                    m_output += "\\f";
+                    break;
+                case '\n':
+                    m_output += "\\n";
+                    break;
+                case '\r':
+                    m_output += "\\r";
+                    break;
+                case '\t':
+                    m_output += "\\t";
+                    break;
+                default:
+                    if (codePoint < 0x20 || codePoint == '<' || codePoint == '>' || IsEscapedCodePoint(codePoint))
+                    {
+                        if (codePoint >= 0x10000)
+                        {
+                            AppendUnicodeEscape(m_output, 0xD800 + ((codePoint - 0x10000) >> 10));
+                            AppendUnicodeEscape(m_output, 0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+                        }
+                        else
+                        {
+                            AppendUnicodeEscape(m_output, codePoint);
+                        }
+                    }
+                    else
+                    {
+                        m_output.append(position, length);
+                    }
+            }
+
+            position += length;
+        }
+
+        m_output += '"';
+    }
+
+    void JsonWriter::Write(bool value)
+    {
+        m_output += value ? "true" : "false";
+    }
+
+    void JsonWriter::Write(int32_t value)
+    {
+        AppendInteger(m_output, value);
+    }
+
+    void JsonWriter::Write(uint32_t value)
+    {
+        AppendInteger(m_output, value);
+    }
+
+    void JsonWriter::Write(int64_t value)
+    {
+        m_output += '"';
+        AppendInteger(m_output, value);
+        m_output += '"';
+    }
+
+    void JsonWriter::Write(uint64_t value)
+    {
+        m_output += '"';
+        AppendInteger(m_output, value);
+        m_output += '"';
+    }
+
+    void JsonWriter::Write(float value)
+    {
+        if (!std::isfinite(value))
+        {
+            Write(static_cast<double>(value));
+            return;
+        }
+
+        // The shortest of the two precisions that reads back, like the reflective printer. It takes the longer one
+        // for subnormal values as well, since their short form reads back with ERANGE.
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.*g", FLT_DIG, static_cast<double>(value));
+
+        errno = 0;
+
+        if (std::strtof(buffer, nullptr) != value || errno == ERANGE)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*g", FLT_DIG + 3, static_cast<double>(value));
+        }
+
+        DelocalizeRadix(buffer);
+        m_output += buffer;
+    }
+
+    void JsonWriter::Write(double value)
+    {
+        if (std::isnan(value))
+        {
+            m_output += "\"NaN\"";
+            return;
+        }
+
+        if (std::isinf(value))
+        {
+            m_output += value > 0 ? "\"Infinity\"" : "\"-Infinity\"";
+            return;
+        }
+
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.*g", DBL_DIG, value);
+
+        if (std::strtod(buffer, nullptr) != value)
+        {
+            std::snprintf(buffer, sizeof(buffer), "%.*g", DBL_DIG + 2, value);
+        }
+
+        DelocalizeRadix(buffer);
+        m_output += buffer;
+    }
+
+    void JsonWriter::WriteEnumName(std::string_view name)
+    {
+        m_output += '"';
+        m_output += name;
+        m_output += '"';
+    }
+
+    void JsonWriter::NewLine()
+    {
+        if (m_addWhitespace)
+        {
+            m_output += '\n';
+            m_output.append(m_hasMembers.size(), ' ');
+        }
+    }
+} // namespace PTSLC_CPP
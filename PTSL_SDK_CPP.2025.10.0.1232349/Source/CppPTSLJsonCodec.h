@@ -0,0 +1,331 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief JSON conversion of the PTSL messages with the codec generated from PTSL.proto.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/util/json_util.h>
+
+namespace PTSLC_CPP
+{
+    /// google::protobuf::util::Status or absl::Status, depending on the protobuf version.
+    using JsonStatus = decltype(google::protobuf::util::JsonStringToMessage(std::string(), nullptr));
+
+    /**
+     * Same as google::protobuf::util::JsonStringToMessage, but uses the generated codec if the message has one.
+     *
+     * The generated codec only accepts the JSON it is sure to read exactly like the reflective parser;
+     * anything else, including all invalid input, is passed to the reflective parser, so the result and the status
+     * are the same either way.
+     */
+    JsonStatus ParseJsonBody(const std::string& json,
+        google::protobuf::Message* message,
+        const google::protobuf::util::JsonParseOptions& options);
+
+    /**
+     * Same as google::protobuf::util::MessageToJsonString, but uses the generated codec if the message has one
+     * and the options are supported by it. Appends to json.
+     */
+    JsonStatus PrintJsonBody(const google::protobuf::Message& message,
+        std::string* json,
+        const google::protobuf::util::JsonOptions& options);
+
+    /**
+     * Parses a body with a long list, e.g. the clips of GetClipListResponseBody, without holding the list:
+     * the elements are decoded one by one into element, a scratch message reused for all of them, and passed
+     * to onElement; body receives the other fields. So besides the JSON, only one element is in memory at a time.
+     *
+     * listField is the repeated message field of the list in body. The status is the one ParseJsonBody gives
+     * for the whole body: anything unusual, e.g. a malformed body or a repeated list key, is left to ParseJsonBody
+     * of the whole body, and its elements not passed yet are passed from there. If the body is invalid,
+     * the elements before the error may have been passed.
+     */
+    JsonStatus ParseJsonListBody(const std::string& json,
+        google::protobuf::Message* body,
+        const google::protobuf::FieldDescriptor* listField,
+        google::protobuf::Message* element,
+        const google::protobuf::util::JsonParseOptions& options,
+        const std::function<void(const google::protobuf::Message& element)>& onElement);
+
+    /**
+     * ParseJsonListBody with a typed callback, e.g.
+     * ParseJsonListBody<ptsl::Clip>(json, &body, "clip_list", options, [](const ptsl::Clip& clip) { ... });
+     */
+    template <typename Element>
+    JsonStatus ParseJsonListBody(const std::string& json,
+        google::protobuf::Message* body,
+        const std::string& listFieldName,
+        const google::protobuf::util::JsonParseOptions& options,
+        const std::function<void(const Element& element)>& onElement)
+    {
+        Element element;
+
+        return ParseJsonListBody(json,
+            body,
+            body->GetDescriptor()->FindFieldByName(listFieldName),
+            &element,
+            options,
+            [&onElement](const google::protobuf::Message& parsed) { onElement(static_cast<const Element&>(parsed)); });
+    }
+
+    /**
+     * Pull reader of JSON text used by the generated codec.
+     *
+     * Every Read function returns false on anything the generated codec doesn't handle, not only on invalid JSON,
+     * e.g. null values, duplicate fields or escaped keys. The caller then falls back to the reflective parser.
+     */
+    class JsonReader
+    {
+    public:
+        JsonReader(std::string_view json, bool ignoreUnknownFields);
+
+        /**
+         * Reads an object, calling readField(key) for each field with the reader positioned at the value.
+         * The key is only valid until the value is read.
+         */
+        template <typename ReadField>
+        bool ReadObject(ReadField&& readField)
+        {
+            if (!Enter('{'))
+            {
+                return false;
+            }
+
+            if (Consume('}'))
+            {
+                return Leave();
+            }
+
+            do
+            {
+                std::string_view key;
+
+                if (!ReadKey(key) || !readField(key))
+                {
+                    return false;
+                }
+            } while (Consume(','));
+
+            return Consume('}') && Leave();
+        }
+
+        /**
+         * Reads an array, calling readElement() with the reader positioned at each element.
+         */
+        template <typename ReadElement>
+        bool ReadArray(ReadElement&& readElement)
+        {
+            if (!Enter('['))
+            {
+                return false;
+            }
+
+            if (Consume(']'))
+            {
+                return Leave();
+            }
+
+            do
+            {
+                if (!readElement())
+                {
+                    return false;
+                }
+            } while (Consume(','));
+
+            return Consume(']') && Leave();
+        }
+
+        bool Read(std::string& value);
+        bool Read(bool& value);
+        bool Read(int32_t& value);
+        bool Read(uint32_t& value);
+        bool Read(int64_t& value);
+        bool Read(uint64_t& value);
+        bool Read(float& value);
+        bool Read(double& value);
+
+        /**
+         * Reads an enum value given by name. Names are identifiers, so escaped names are left to the fallback.
+         */
+        bool ReadEnumName(std::string_view& name);
+
+        bool IsString();
+
+        /**
+         * Skips the value of a field the message doesn't have, if unknown fields are ignored.
+         */
+        bool SkipUnknownValue();
+
+        /**
+         * Returns true if nothing but whitespace is left.
+         */
+        bool IsAtEnd();
+
+    private:
+        void SkipWhitespace();
+        bool Consume(char c);
+        bool Enter(char c);
+        bool Leave();
+        bool ReadKey(std::string_view& key);
+        bool ReadNumberToken(std::string_view& token);
+
+        template <typename Integer>
+        bool ReadInteger(Integer& value);
+
+        template <typename Floating>
+        bool ReadFloating(Floating& value);
+
+        bool SkipValue();
+        bool SkipString();
+
+        const char* m_position;
+        const char* const m_end;
+        const bool m_ignoreUnknownFields;
+        int32_t m_depth = 0;
+    };
+
+    /**
+     * Writer of JSON text used by the generated codec, formatted like the reflective printer.
+     */
+    class JsonWriter
+    {
+    public:
+        JsonWriter(std::string& output, bool addWhitespace, bool printDefaults);
+
+        /**
+         * Returns true if fields with default values are written, see always_print_fields_with_no_presence.
+         */
+        bool PrintsDefaults() const
+        {
+            return m_printDefaults;
+        }
+
+        /**
+         * Returns false if a string wasn't valid UTF-8 and the output has to be produced by the reflective printer.
+         */
+        bool IsValid() const
+        {
+            return m_isValid;
+        }
+
+        /**
+         * Returns true if a field without presence has its default value, i.e. isn't written unless PrintsDefaults.
+         */
+        static bool IsDefault(bool value)
+        {
+            return !value;
+        }
+
+        template <typename Integer>
+        static std::enable_if_t<std::is_integral_v<Integer>, bool> IsDefault(Integer value)
+        {
+            return value == 0;
+        }
+
+        /// Negative zero isn't the default.
+        static bool IsDefault(float value)
+        {
+            return std::signbit(value) == false && value == 0;
+        }
+
+        static bool IsDefault(double value)
+        {
+            return std::signbit(value) == false && value == 0;
+        }
+
+        void BeginObject();
+        void EndObject();
+        void BeginArray();
+        void EndArray();
+
+        /**
+         * Starts a field. The key must not need escaping.
+         */
+        void Key(std::string_view key);
+
+        /**
+         * Starts an array element.
+         */
+        void NextElement();
+
+        void Write(const std::string& value);
+        void Write(bool value);
+        void Write(int32_t value);
+        void Write(uint32_t value);
+        void Write(int64_t value);
+        void Write(uint64_t value);
+        void Write(float value);
+        void Write(double value);
+
+        /**
+         * Writes an enum value name. The name must not need escaping.
+         */
+        void WriteEnumName(std::string_view name);
+
+    private:
+        void NewLine();
+
+        std::string& m_output;
+        const bool m_addWhitespace;
+        const bool m_printDefaults;
+        bool m_isValid = true;
+
+        /// Whether the open objects and arrays already have members.
+        std::vector<bool> m_hasMembers;
+    };
+
+    /**
+     * Duplicate field detection of the generated readers.
+     */
+    template <size_t FieldCount>
+    class JsonFieldSet
+    {
+    public:
+        /**
+         * Returns false if the field has been read before.
+         */
+        bool Insert(size_t index)
+        {
+            if (m_fields.test(index))
+            {
+                return false;
+            }
+
+            m_fields.set(index);
+            return true;
+        }
+
+    private:
+        std::bitset<FieldCount> m_fields;
+    };
+
+    struct GeneratedJsonCodec
+    {
+        bool (*m_read)(JsonReader& reader, google::protobuf::Message& message);
+        void (*m_write)(JsonWriter& writer, const google::protobuf::Message& message);
+    };
+
+    /**
+     * Returns the generated codec of the message type, or null if it has none.
+     * Defined in the generated PTSL.json.cc, see generate_json_codec_files in CMake/Utils.cmake.
+     */
+    const GeneratedJsonCodec* FindGeneratedJsonCodec(const google::protobuf::Descriptor* descriptor);
+} // namespace PTSLC_CPP
@@ -0,0 +1,427 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLJsonField.h
+ */
+
+#include "CppPTSLJsonField.h"
+#include "CppPTSLJsonScanner.h"
+
+#include <algorithm>
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        using namespace JsonScanner;
+
+        /**
+         * Moves p from the object at p to the value of its first field with the name.
+         */
+        bool FindMember(Position& p, Position end, std::string_view name)
+        {
+            if (!Consume(p, end, '{') || (p != end && *p == '}'))
+            {
+                return false;
+            }
+
+            while (true)
+            {
+                std::string_view key;
+
+                if (p == end || *p != '"' || !SkipString(p, end, key) || !Consume(p, end, ':'))
+                {
+                    return false;
+                }
+
+                if (KeyEquals(key, name))
+                {
+                    return p != end;
+                }
+
+                if (!SkipValue(p, end) || !Consume(p, end, ','))
+                {
+                    // the end of the object, or a malformed one
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * Moves p from the array at p to its element with the index.
+         */
+        bool FindElement(Position& p, Position end, size_t index)
+        {
+            if (!Consume(p, end, '[') || (p != end && *p == ']'))
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i != index; ++i)
+            {
+                if (!SkipValue(p, end) || !Consume(p, end, ','))
+                {
+                    return false;
+                }
+            }
+
+            return p != end;
+        }
+
+        /**
+         * Returns the value of the path inside the value at p, or null if there is none.
+         */
+        Position FindPath(Position p, Position end, std::string_view path)
+        {
+            while (!path.empty())
+            {
+                if (path.front() == '[')
+                {
+                    const size_t close = path.find(']');
+                    size_t index = 0;
+
+                    if (close == std::string_view::npos)
+                    {
+                        return nullptr;
+                    }
+
+                    const auto result = std::from_chars(path.data() + 1, path.data() + close, index);
+
+                    if (result.ec != std::errc() || result.ptr != path.data() + close || !FindElement(p, end, index))
+                    {
+                        return nullptr;
+                    }
+
+                    path.remove_prefix(close + 1);
+                }
+                else
+                {
+                    const std::string_view name = path.substr(0, path.find_first_of(".["));
+
+                    if (name.empty() || !FindMember(p, end, name))
+                    {
+                        return nullptr;
+                    }
+
+                    path.remove_prefix(name.size());
+                }
+
+                if (!path.empty() && path.front() == '.')
+                {
+                    path.remove_prefix(1);
+
+                    if (path.empty())
+                    {
+                        return nullptr;
+                    }
+                }
+            }
+
+            return p;
+        }
+
+        /**
+         * Returns the text of a number, given either as a number or as a string.
+         */
+        std::optional<std::string_view> NumberText(Position p, Position end)
+        {
+            if (*p != '"')
+            {
+                return ScalarToken(p, end);
+            }
+
+            std::string_view contents;
+
+            if (!SkipString(p, end, contents) || contents.find('\\') != std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            return contents;
+        }
+
+        std::optional<double> ParseDouble(std::string_view text)
+        {
+            char buffer[64];
+
+            if (text.empty() || text.size() >= sizeof(buffer) || (text.front() != '-' && (text.front() < '0' || text.front() > '9'))
+                || text.find_first_not_of("0123456789.eE+-") != std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            std::memcpy(buffer, text.data(), text.size());
+            buffer[text.size()] = '\0';
+
+            // strtod expects the decimal separator of the current locale
+            const char decimalPoint = *std::localeconv()->decimal_point;
+
+            if (decimalPoint != '.')
+            {
+                std::replace(buffer, buffer + text.size(), '.', decimalPoint);
+            }
+
+            char* parsedEnd = nullptr;
+            const double value = std::strtod(buffer, &parsedEnd);
+
+            if (parsedEnd != buffer + text.size() || !std::isfinite(value))
+            {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+        template <typename Integer>
+        std::optional<Integer> ReadInteger(Position p, Position end)
+        {
+            const auto text = NumberText(p, end);
+
+            if (!text)
+            {
+                return std::nullopt;
+            }
+
+            Integer value = 0;
+            const auto result = std::from_chars(text->data(), text->data() + text->size(), value);
+
+            if (result.ec == std::errc() && result.ptr == text->data() + text->size())
+            {
+                return value;
+            }
+
+            // integral values written with a fraction or an exponent, e.g. 1.0 or 1e3
+            const auto number = ParseDouble(*text);
+            const double lowest = static_cast<double>(std::numeric_limits<Integer>::lowest());
+            const double limit = std::ldexp(1.0, std::numeric_limits<Integer>::digits);
+
+            if (!number || std::trunc(*number) != *number || *number < lowest || *number >= limit)
+            {
+                return std::nullopt;
+            }
+
+            return static_cast<Integer>(*number);
+        }
+    } // namespace
+
+    CppPTSLJsonField::CppPTSLJsonField(std::shared_ptr<const std::string> document)
+    {
+        if (!document)
+        {
+            return;
+        }
+
+        Position p = document->data();
+        const Position end = p + document->size();
+        SkipWhitespace(p, end);
+
+        if (p != end)
+        {
+            mDocument = std::move(document);
+            mValue = p;
+        }
+    }
+
+    CppPTSLJsonField::CppPTSLJsonField(std::shared_ptr<const std::string> document, const char* value)
+        : mDocument(std::move(document)), mValue(value)
+    {
+    }
+
+    bool CppPTSLJsonField::Exists() const
+    {
+        return mValue != nullptr;
+    }
+
+    bool CppPTSLJsonField::IsNull() const
+    {
+        return mValue && ScalarToken(mValue, mDocument->data() + mDocument->size()) == "null";
+    }
+
+    std::optional<int64_t> CppPTSLJsonField::AsInt() const
+    {
+        return mValue ? ReadInteger<int64_t>(mValue, mDocument->data() + mDocument->size()) : std::nullopt;
+    }
+
+    std::optional<uint64_t> CppPTSLJsonField::AsUInt() const
+    {
+        return mValue ? ReadInteger<uint64_t>(mValue, mDocument->data() + mDocument->size()) : std::nullopt;
+    }
+
+    std::optional<double> CppPTSLJsonField::AsDouble() const
+    {
+        if (!mValue)
+        {
+            return std::nullopt;
+        }
+
+        const auto text = NumberText(mValue, mDocument->data() + mDocument->size());
+
+        if (!text)
+        {
+            return std::nullopt;
+        }
+
+        if (*mValue == '"')
+        {
+            if (*text == "NaN")
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            if (*text == "Infinity" || *text == "-Infinity")
+            {
+                return text->front() == '-' ? -std::numeric_limits<double>::infinity()
+                                            : std::numeric_limits<double>::infinity();
+            }
+        }
+
+        return ParseDouble(*text);
+    }
+
+    std::optional<bool> CppPTSLJsonField::AsBool() const
+    {
+        if (!mValue)
+        {
+            return std::nullopt;
+        }
+
+        const std::string_view token = ScalarToken(mValue, mDocument->data() + mDocument->size());
+
+        if (token == "true" || token == "false")
+        {
+            return token == "true";
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<std::string> CppPTSLJsonField::AsString() const
+    {
+        if (!mValue || *mValue != '"')
+        {
+            return std::nullopt;
+        }
+
+        Position p = mValue;
+        std::string_view contents;
+
+        if (!SkipString(p, mDocument->data() + mDocument->size(), contents))
+        {
+            return std::nullopt;
+        }
+
+        std::string value;
+        value.reserve(contents.size());
+
+        p = contents.data();
+        const Position end = contents.data() + contents.size();
+
+        while (p != end)
+        {
+            const void* found = std::memchr(p, '\\', static_cast<size_t>(end - p));
+            const Position escape = found ? static_cast<Position>(found) : end;
+            value.append(p, escape);
+            p = escape;
+
+            if (p != end)
+            {
+                char decoded[4];
+                size_t length = 0;
+
+                if (!DecodeEscape(p, end, decoded, length))
+                {
+                    return std::nullopt;
+                }
+
+                value.append(decoded, length);
+            }
+        }
+
+        return value;
+    }
+
+    std::string_view CppPTSLJsonField::GetRawJson() const
+    {
+        if (!mValue)
+        {
+            return {};
+        }
+
+        Position p = mValue;
+
+        if (!SkipValue(p, mDocument->data() + mDocument->size()))
+        {
+            return {};
+        }
+
+        return std::string_view(mValue, static_cast<size_t>(p - mValue));
+    }
+
+    CppPTSLJsonField CppPTSLJsonField::Field(std::string_view path) const
+    {
+        if (!mValue)
+        {
+            return {};
+        }
+
+        const Position value = FindPath(mValue, mDocument->data() + mDocument->size(), path);
+        return value ? CppPTSLJsonField(mDocument, value) : CppPTSLJsonField();
+    }
+
+    bool CppPTSLJsonField::ForEachElement(const std::function<void(const CppPTSLJsonField& element)>& onElement) const
+    {
+        if (!mValue)
+        {
+            return false;
+        }
+
+        Position p = mValue;
+        const Position end = mDocument->data() + mDocument->size();
+
+        if (!Consume(p, end, '['))
+        {
+            return false;
+        }
+
+        if (p != end && *p == ']')
+        {
+            return true;
+        }
+
+        // one field moved from element to element
+        CppPTSLJsonField element(mDocument, nullptr);
+
+        while (true)
+        {
+            const Position value = p;
+
+            if (!SkipValue(p, end))
+            {
+                return false;
+            }
+
+            element.mValue = value;
+            onElement(element);
+
+            SkipWhitespace(p, end);
+
+            if (p != end && *p == ']')
+            {
+                return true;
+            }
+
+            if (!Consume(p, end, ','))
+            {
+                return false;
+            }
+        }
+    }
+} // namespace PTSLC_CPP
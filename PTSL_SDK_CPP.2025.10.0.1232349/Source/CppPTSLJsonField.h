@@ -0,0 +1,103 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief class that gives on-demand access to single values of a response body JSON.
+ *
+ * See CppPTSLJsonField.cpp to view all initialization details.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "PtslCCppExport.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Value of a JSON document found by a path like "pagination_response.total" or "track_list[2].name",
+     * see CppPTSLResponse::Field.
+     *
+     * The document is not parsed: finding a value only scans the bytes before it, skipping the values on the way
+     * without looking into them, and reading a value only parses the value itself. So nothing else of the document
+     * is validated, and a malformed document may give values a full parse would reject.
+     * Keys are matched to the first field of an object with the name, unlike parsers that keep the last duplicate.
+     *
+     * The field keeps the document alive, so it stays valid after the response is gone.
+     */
+    class PTSLC_CPP_EXPORT CppPTSLJsonField
+    {
+    public:
+        /**
+         * Creates a missing field.
+         */
+        CppPTSLJsonField() = default;
+
+        /**
+         * Returns false if the path wasn't found or the document is malformed on the way to it.
+         */
+        bool Exists() const;
+
+        bool IsNull() const;
+
+        /**
+         * Integer value given either by a number or a string, as protobuf writes 64-bit integers.
+         * Returns std::nullopt if the value isn't an integer or doesn't fit.
+         */
+        std::optional<int64_t> AsInt() const;
+        std::optional<uint64_t> AsUInt() const;
+
+        /**
+         * Number given either by a number or a string, including "NaN", "Infinity" and "-Infinity".
+         */
+        std::optional<double> AsDouble() const;
+
+        std::optional<bool> AsBool() const;
+
+        /**
+         * Unescaped string value, e.g. the name of an enum value.
+         */
+        std::optional<std::string> AsString() const;
+
+        /**
+         * Returns the JSON text of the value; empty if the field doesn't exist or is malformed.
+         * Unlike the other accessors, scans the whole value.
+         */
+        std::string_view GetRawJson() const;
+
+        /**
+         * Looks for the path inside this value. An empty path returns this field.
+         */
+        CppPTSLJsonField Field(std::string_view path) const;
+
+        /**
+         * Calls onElement for each element of the array, e.g. the clips of a GetClipList body, in a single pass.
+         * The elements are only skipped over, so reading them costs no more than reading fields of the body.
+         * Returns false if the value isn't an array or is malformed; the elements before the error have been visited.
+         */
+        bool ForEachElement(const std::function<void(const CppPTSLJsonField& element)>& onElement) const;
+
+    private:
+        friend class CppPTSLResponse;
+
+        /**
+         * Creates the field of the whole document; missing if the document is null or blank.
+         */
+        explicit CppPTSLJsonField(std::shared_ptr<const std::string> document);
+
+        CppPTSLJsonField(std::shared_ptr<const std::string> document, const char* value);
+
+        /// Keeps the document alive; null if the field doesn't exist.
+        std::shared_ptr<const std::string> mDocument;
+
+        /// Start of the value in the document.
+        const char* mValue = nullptr;
+    };
+} // namespace PTSLC_CPP
@@ -0,0 +1,504 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLJsonScanner.h
+ */
+
+#include "CppPTSLJsonScanner.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define PTSLC_JSON_SCAN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define PTSLC_JSON_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        using JsonScanner::Position;
+
+        unsigned CountTrailingZeros(uint64_t value)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index = 0;
+            _BitScanForward64(&index, value);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+        }
+
+        /**
+         * Returns the first of the characters at or after p, or end if there is none.
+         * Compares 16 bytes at a time where SSE2 or NEON is available.
+         */
+        template <char... Chars>
+        Position FindAny(Position p, Position end)
+        {
+#if defined(PTSLC_JSON_SCAN_SSE2)
+            while (end - p >= 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i matches = _mm_setzero_si128();
+                ((matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(Chars)))), ...);
+
+                const int mask = _mm_movemask_epi8(matches);
+
+                if (mask != 0)
+                {
+                    return p + CountTrailingZeros(static_cast<uint64_t>(mask));
+                }
+
+                p += 16;
+            }
+#elif defined(PTSLC_JSON_SCAN_NEON)
+            while (end - p >= 16)
+            {
+                const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+                uint8x16_t matches = vdupq_n_u8(0);
+                ((matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(Chars))))), ...);
+
+                // four bits per byte
+                const uint64_t mask =
+                    vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+
+                if (mask != 0)
+                {
+                    return p + CountTrailingZeros(mask) / 4;
+                }
+
+                p += 16;
+            }
+#endif
+            while (p != end && ((*p != Chars) && ...))
+            {
+                ++p;
+            }
+
+            return p;
+        }
+
+        /**
+         * Bits of the characters of a 64-byte block that matter for skipping objects and arrays.
+         */
+        struct StructuralMasks
+        {
+            uint64_t m_quotes = 0;
+            uint64_t m_backslashes = 0;
+            uint64_t m_opening = 0;
+            uint64_t m_closing = 0;
+        };
+
+        // '{' and '[' as well as '}' and ']' differ only in the bit 0x20.
+        constexpr char CASE_BIT = 0x20;
+
+#if defined(PTSLC_JSON_SCAN_NEON)
+        uint64_t MoveMask(uint8x16_t matches)
+        {
+            static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+
+            uint8x16_t bits = vandq_u8(matches, vld1q_u8(weights));
+            bits = vpaddq_u8(bits, bits);
+            bits = vpaddq_u8(bits, bits);
+            bits = vpaddq_u8(bits, bits);
+            return vgetq_lane_u16(vreinterpretq_u16_u8(bits), 0);
+        }
+#endif
+
+        StructuralMasks ScanBlock(Position p)
+        {
+            StructuralMasks masks;
+
+            for (int offset = 0; offset != 64; offset += 16)
+            {
+#if defined(PTSLC_JSON_SCAN_SSE2)
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset));
+                const __m128i folded = _mm_or_si128(block, _mm_set1_epi8(CASE_BIT));
+                const auto mask = [](__m128i matches) {
+                    return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches)));
+                };
+
+                masks.m_quotes |= mask(_mm_cmpeq_epi8(block, _mm_set1_epi8('"'))) << offset;
+                masks.m_backslashes |= mask(_mm_cmpeq_epi8(block, _mm_set1_epi8('\\'))) << offset;
+                masks.m_opening |= mask(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{'))) << offset;
+                masks.m_closing |= mask(_mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))) << offset;
+#elif defined(PTSLC_JSON_SCAN_NEON)
+                const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(p + offset));
+                const uint8x16_t folded = vorrq_u8(block, vdupq_n_u8(CASE_BIT));
+
+                masks.m_quotes |= MoveMask(vceqq_u8(block, vdupq_n_u8('"'))) << offset;
+                masks.m_backslashes |= MoveMask(vceqq_u8(block, vdupq_n_u8('\\'))) << offset;
+                masks.m_opening |= MoveMask(vceqq_u8(folded, vdupq_n_u8('{'))) << offset;
+                masks.m_closing |= MoveMask(vceqq_u8(folded, vdupq_n_u8('}'))) << offset;
+#else
+                for (int i = offset; i != offset + 16; ++i)
+                {
+                    const uint64_t bit = uint64_t { 1 } << i;
+                    const char folded = static_cast<char>(p[i] | CASE_BIT);
+
+                    masks.m_quotes |= p[i] == '"' ? bit : 0;
+                    masks.m_backslashes |= p[i] == '\\' ? bit : 0;
+                    masks.m_opening |= folded == '{' ? bit : 0;
+                    masks.m_closing |= folded == '}' ? bit : 0;
+                }
+#endif
+            }
+
+            return masks;
+        }
+
+        /**
+         * Bit i of the result is the parity of the bits 0 to i, i.e. set inside the strings of a block
+         * with the quotes at the bits.
+         */
+        uint64_t PrefixXor(uint64_t bits)
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+
+        bool IsWhitespace(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        bool ReadHex(Position& p, Position end, uint32_t& value)
+        {
+            if (end - p < 4)
+            {
+                return false;
+            }
+
+            const auto result = std::from_chars(p, p + 4, value, 16);
+
+            if (result.ec != std::errc() || result.ptr != p + 4)
+            {
+                return false;
+            }
+
+            p += 4;
+            return true;
+        }
+
+        /**
+         * Skips the object or array at p, looking only at the brackets and the strings.
+         *
+         * Works on 64-byte blocks: the brackets inside strings are masked out with the prefix parity of the quotes.
+         * Blocks with escapes, which are rare, are walked byte by byte instead.
+         */
+        bool SkipContainer(Position& p, Position end)
+        {
+            int64_t depth = 0;
+            bool isInString = false;
+            bool isEscaped = false;
+
+            while (p != end)
+            {
+                if (end - p >= 64 && !isEscaped)
+                {
+                    const StructuralMasks masks = ScanBlock(p);
+
+                    if (masks.m_backslashes == 0)
+                    {
+                        const uint64_t strings = PrefixXor(masks.m_quotes) ^ (isInString ? ~uint64_t { 0 } : 0);
+                        uint64_t brackets = (masks.m_opening | masks.m_closing) & ~strings;
+
+                        isInString = (strings >> 63) != 0;
+
+                        while (brackets != 0)
+                        {
+                            const unsigned index = CountTrailingZeros(brackets);
+                            depth += ((masks.m_opening >> index) & 1) ? 1 : -1;
+
+                            if (depth == 0)
+                            {
+                                p += index + 1;
+                                return true;
+                            }
+
+                            brackets &= brackets - 1;
+                        }
+
+                        p += 64;
+                        continue;
+                    }
+                }
+
+                const Position blockEnd = p + std::min<ptrdiff_t>(64, end - p);
+
+                for (; p != blockEnd; ++p)
+                {
+                    if (isInString)
+                    {
+                        if (isEscaped)
+                        {
+                            isEscaped = false;
+                        }
+                        else if (*p == '\\')
+                        {
+                            isEscaped = true;
+                        }
+                        else if (*p == '"')
+                        {
+                            isInString = false;
+                        }
+                    }
+                    else if (*p == '"')
+                    {
+                        isInString = true;
+                    }
+                    else if (*p == '{' || *p == '[')
+                    {
+                        ++depth;
+                    }
+                    else if ((*p == '}' || *p == ']') && --depth == 0)
+                    {
+                        ++p;
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+    } // namespace
+
+    namespace JsonScanner
+    {
+        void SkipWhitespace(Position& p, Position end)
+        {
+            while (p != end && IsWhitespace(*p))
+            {
+                ++p;
+            }
+        }
+
+        bool Consume(Position& p, Position end, char c)
+        {
+            SkipWhitespace(p, end);
+
+            if (p == end || *p != c)
+            {
+                return false;
+            }
+
+            ++p;
+            SkipWhitespace(p, end);
+            return true;
+        }
+
+        bool SkipString(Position& p, Position end, std::string_view& contents)
+        {
+            const Position begin = ++p;
+
+            while (true)
+            {
+                p = FindAny<'"', '\\'>(p, end);
+
+                if (p == end)
+                {
+                    return false;
+                }
+
+                if (*p == '"')
+                {
+                    contents = std::string_view(begin, static_cast<size_t>(p - begin));
+                    ++p;
+                    return true;
+                }
+
+                if (end - p < 2)
+                {
+                    return false;
+                }
+
+                p += 2;
+            }
+        }
+
+        std::string_view ScalarToken(Position p, Position end)
+        {
+            const Position begin = p;
+
+            while (p != end && !IsWhitespace(*p) && *p != ',' && *p != '}' && *p != ']' && *p != ':')
+            {
+                ++p;
+            }
+
+            return std::string_view(begin, static_cast<size_t>(p - begin));
+        }
+
+        bool SkipValue(Position& p, Position end)
+        {
+            if (p == end)
+            {
+                return false;
+            }
+
+            if (*p == '"')
+            {
+                std::string_view contents;
+                return SkipString(p, end, contents);
+            }
+
+            if (*p == '{' || *p == '[')
+            {
+                return SkipContainer(p, end);
+            }
+
+            const size_t length = ScalarToken(p, end).size();
+            p += length;
+            return length != 0;
+        }
+
+        bool DecodeEscape(Position& p, Position end, char (&decoded)[4], size_t& length)
+        {
+            if (end - p < 2)
+            {
+                return false;
+            }
+
+            const char escaped = p[1];
+            p += 2;
+            length = 1;
+
+            switch (escaped)
+            {
+                case '"':
+                case '\\':
+                case '/':
+                    decoded[0] = escaped;
+                    return true;
+                case 'b':
+                    decoded[0] = '\b';
+                    return true;
+                case 'f':
+                    decoded[0] = '\f';
+                    return true;
+                case 'n':
+                    decoded[0] = '\n';
+                    return true;
+                case 'r':
+                    decoded[0] = '\r';
+                    return true;
+                case 't':
+                    decoded[0] = '\t';
+                    return true;
+                case 'u':
+                    break;
+                default:
+                    return false;
+            }
+
+            uint32_t codePoint = 0;
+
+            if (!ReadHex(p, end, codePoint) || (codePoint >= 0xDC00 && codePoint <= 0xDFFF))
+            {
+                return false;
+            }
+
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                uint32_t low = 0;
+
+                if (end - p < 2 || p[0] != '\\' || p[1] != 'u')
+                {
+                    return false;
+                }
+
+                p += 2;
+
+                if (!ReadHex(p, end, low) || low < 0xDC00 || low > 0xDFFF)
+                {
+                    return false;
+                }
+
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+
+            if (codePoint < 0x80)
+            {
+                decoded[0] = static_cast<char>(codePoint);
+            }
+            else if (codePoint < 0x800)
+            {
+                decoded[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                decoded[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                length = 2;
+            }
+            else if (codePoint < 0x10000)
+            {
+                decoded[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                decoded[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                decoded[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                length = 3;
+            }
+            else
+            {
+                decoded[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+                decoded[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                decoded[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                decoded[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                length = 4;
+            }
+
+            return true;
+        }
+
+        bool KeyEquals(std::string_view key, std::string_view name)
+        {
+            if (key.find('\\') == std::string_view::npos)
+            {
+                return key == name;
+            }
+
+            Position p = key.data();
+            const Position end = key.data() + key.size();
+
+            while (p != end)
+            {
+                if (*p != '\\')
+                {
+                    if (name.empty() || name.front() != *p)
+                    {
+                        return false;
+                    }
+
+                    name.remove_prefix(1);
+                    ++p;
+                    continue;
+                }
+
+                char decoded[4];
+                size_t length = 0;
+
+                if (!DecodeEscape(p, end, decoded, length) || name.substr(0, length) != std::string_view(decoded, length))
+                {
+                    return false;
+                }
+
+                name.remove_prefix(length);
+            }
+
+            return name.empty();
+        }
+    } // namespace JsonScanner
+} // namespace PTSLC_CPP
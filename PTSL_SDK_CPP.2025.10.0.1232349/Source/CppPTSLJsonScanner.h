@@ -0,0 +1,59 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Structural scanning of JSON text without parsing it, shared by CppPTSLJsonField and the list decoder.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace PTSLC_CPP
+{
+    /**
+     * The functions move p forward over the text up to end and return false if the text is malformed there.
+     * Only what is needed to find the end of a value is looked at, so skipped values aren't validated.
+     */
+    namespace JsonScanner
+    {
+        using Position = const char*;
+
+        void SkipWhitespace(Position& p, Position end);
+
+        /**
+         * Skips c, and the whitespace around it.
+         */
+        bool Consume(Position& p, Position end, char c);
+
+        /**
+         * Skips the string at p and returns its contents, still escaped.
+         */
+        bool SkipString(Position& p, Position end, std::string_view& contents);
+
+        /**
+         * Returns the number or literal at p.
+         */
+        std::string_view ScalarToken(Position p, Position end);
+
+        /**
+         * Skips the value at p. Objects and arrays are skipped in 64-byte blocks where SSE2 or NEON is available:
+         * the brackets inside strings are masked out with the prefix parity of the quotes.
+         */
+        bool SkipValue(Position& p, Position end);
+
+        /**
+         * Decodes the escape sequence at p (at the backslash) to UTF-8.
+         */
+        bool DecodeEscape(Position& p, Position end, char (&decoded)[4], size_t& length);
+
+        /**
+         * Compares the escaped contents of a key to a name without unescaping them into a buffer.
+         */
+        bool KeyEquals(std::string_view key, std::string_view name);
+    } // namespace JsonScanner
+} // namespace PTSLC_CPP
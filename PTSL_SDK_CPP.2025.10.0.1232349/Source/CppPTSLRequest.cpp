@@ -84,4 +84,54 @@ namespace PTSLC_CPP
     {
         mRequestBodyJson = requestBodyJson;
     }
+
+    RequestRouting CppPTSLRequest::GetRouting() const
+    {
+        return mRouting;
+    }
+
+    void CppPTSLRequest::SetRouting(const RequestRouting routing)
+    {
+        mRouting = routing;
+    }
+
+    std::chrono::milliseconds CppPTSLRequest::GetTimeout() const
+    {
+        return mTimeout;
+    }
+
+    void CppPTSLRequest::SetTimeout(const std::chrono::milliseconds timeout)
+    {
+        mTimeout = timeout;
+    }
+
+    RetryPolicy CppPTSLRequest::GetRetryPolicy() const
+    {
+        return mRetryPolicy;
+    }
+
+    void CppPTSLRequest::SetRetryPolicy(const RetryPolicy& retryPolicy)
+    {
+        mRetryPolicy = retryPolicy;
+    }
+
+    RequestPriority CppPTSLRequest::GetPriority() const
+    {
+        return mPriority;
+    }
+
+    void CppPTSLRequest::SetPriority(const RequestPriority priority)
+    {
+        mPriority = priority;
+    }
+
+    std::optional<CancellationToken> CppPTSLRequest::GetCancellationToken() const
+    {
+        return mCancellationToken;
+    }
+
+    void CppPTSLRequest::SetCancellationToken(const CancellationToken& cancellationToken)
+    {
+        mCancellationToken = cancellationToken;
+    }
 } // namespace PTSLC_CPP
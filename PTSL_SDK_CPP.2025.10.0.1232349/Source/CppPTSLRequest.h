@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <optional>
+
+#include "CppPTSLCancellationToken.h"
 #include "CppPTSLCommon.h"
 #include "PtslCCppExport.h"
 
@@ -41,6 +44,40 @@ namespace PTSLC_CPP
 
         std::string GetRequestBodyJson() const;
         void SetRequestBodyJson(const std::string& requestBodyJson);
+
+        /**
+         * Overrides the gRPC method selected for the command by default.
+         * Forcing RRouting_Unary on a command with intermediate responses drops them.
+         */
+        RequestRouting GetRouting() const;
+        void SetRouting(const RequestRouting routing);
+
+        /**
+         * Deadline of the whole request, counted from the moment the client dispatches it: the wait for an admission
+         * slot, all attempts and the backoffs between them end by then, and no retry is scheduled past it.
+         * Every attempt gets the time left, or less with RetryPolicy::attemptTimeout.
+         * Zero (default) means that the request waits for the response without a limit.
+         */
+        std::chrono::milliseconds GetTimeout() const;
+        void SetTimeout(const std::chrono::milliseconds timeout);
+
+        RetryPolicy GetRetryPolicy() const;
+        void SetRetryPolicy(const RetryPolicy& retryPolicy);
+
+        /**
+         * Order of the request among the ones waiting for an admission slot.
+         * Has no effect if the client has no admission limits, see ClientConfig::maxInFlightRequests.
+         * Event and batch job control commands are never queued.
+         */
+        RequestPriority GetPriority() const;
+        void SetPriority(const RequestPriority priority);
+
+        /**
+         * Token which cancels this request without affecting the other requests of the client.
+         * The same token can be attached to several requests.
+         */
+        std::optional<CancellationToken> GetCancellationToken() const;
+        void SetCancellationToken(const CancellationToken& cancellationToken);
     private:
         // data of request header
         CommandId mCommandId = CommandId::CId_None;
@@ -52,5 +89,12 @@ namespace PTSLC_CPP
 
         // data of request body
         std::string mRequestBodyJson = "";
+
+        // transport options
+        RequestRouting mRouting = RequestRouting::RRouting_Auto;
+        std::chrono::milliseconds mTimeout { 0 };
+        RetryPolicy mRetryPolicy;
+        RequestPriority mPriority = RequestPriority::RPriority_Normal;
+        std::optional<CancellationToken> mCancellationToken;
     };
 } // namespace PTSLC_CPP
@@ -9,13 +9,92 @@
 #include "CppPTSLResponse.h"
 #include "CppPTSLClientInternal.h"
 
+#include <mutex>
+
 namespace PTSLC_CPP
 {
+    /**
+     * Error JSON and the errors parsed from it on demand.
+     */
+    struct CppPTSLResponse::ErrorData
+    {
+        explicit ErrorData(std::string&& errorJson) : json(std::move(errorJson))
+        {
+        }
+
+        std::string json;
+
+        std::once_flag parseFlag;
+        std::vector<CommandError> errors;
+    };
+
+    namespace
+    {
+        std::shared_ptr<std::string> MakeBuffer(std::string&& json)
+        {
+            return json.empty() ? nullptr : std::make_shared<std::string>(std::move(json));
+        }
+
+        std::string_view ViewBuffer(const std::shared_ptr<std::string>& buffer)
+        {
+            return buffer ? std::string_view { *buffer } : std::string_view {};
+        }
+
+        std::string TakeBuffer(std::shared_ptr<std::string>&& buffer)
+        {
+            if (!buffer)
+            {
+                return {};
+            }
+
+            // Other copies of the response must keep seeing the same contents.
+            std::shared_ptr<std::string> taken = std::move(buffer);
+            return taken.use_count() == 1 ? std::move(*taken) : *taken;
+        }
+
+        void ConvertProtoToCommandError(const ptsl::CommandError& in, CommandError& out)
+        {
+            out.errorType = static_cast<CommandErrorType>(in.command_error_type());
+            out.errorMessage = in.command_error_message();
+            out.isWarning = in.is_warning();
+        }
+
+        std::vector<CommandError> ParseResponseErrors(const std::string& errorJson)
+        {
+            using namespace google::protobuf::util;
+
+            JsonParseOptions jOpts = DefaultJsonParseOptions();
+
+            ptsl::ResponseError responseError;
+
+            auto status = ParseJsonBody(errorJson, &responseError, jOpts);
+
+            if (!status.ok())
+            {
+                ptsl::CommandError legacyError;
+                auto legacy_err_status = ParseJsonBody(errorJson, &legacyError, JsonParseOptions());
+                if (legacy_err_status.ok())
+                {
+                    responseError.add_errors()->CopyFrom(legacyError);
+                }
+            }
+
+            std::vector<CommandError> errors(responseError.errors_size());
+
+            for (int i = 0; i < responseError.errors_size(); ++i)
+            {
+                ConvertProtoToCommandError(responseError.errors(i), errors[i]);
+            }
+
+            return errors;
+        }
+    } // namespace
+
     CppPTSLResponse::CppPTSLResponse(
         CommandId commandId, const std::string& responseBodyJson, const std::string& responseErrorJson)
         : mCommandId(commandId),
-          mResponseBodyJson(responseBodyJson),
-          mResponseErrorJson(responseErrorJson)
+          mResponseBodyJson(MakeBuffer(std::string { responseBodyJson })),
+          mResponseErrorJson(responseErrorJson.empty() ? nullptr : std::make_shared<ErrorData>(std::string { responseErrorJson }))
     {
     }
 
@@ -59,65 +138,94 @@ namespace PTSLC_CPP
         mProgress = progress;
     }
 
-    std::string CppPTSLResponse::GetResponseBodyJson() const
+    std::string CppPTSLResponse::GetResponseBodyJson() const&
     {
-        return mResponseBodyJson;
+        return std::string { ViewBuffer(mResponseBodyJson) };
     }
 
-    void CppPTSLResponse::SetResponseBodyJson(const std::string& responseBodyJson)
+    std::string CppPTSLResponse::GetResponseBodyJson() &&
     {
-        mResponseBodyJson = responseBodyJson;
+        return TakeBuffer(std::move(mResponseBodyJson));
     }
 
-    std::string CppPTSLResponse::GetResponseErrorJson() const
+    std::string_view CppPTSLResponse::GetResponseBodyJsonView() const
     {
-        return mResponseErrorJson;
+        return ViewBuffer(mResponseBodyJson);
     }
 
-    void CppPTSLResponse::SetResponseErrorJson(const std::string& responseErrorJson)
+    CppPTSLJsonField CppPTSLResponse::Field(std::string_view path) const
     {
-        mResponseErrorJson = responseErrorJson;
-        ParseResponseError();
+        return CppPTSLJsonField(mResponseBodyJson).Field(path);
     }
 
-    ResponseError CppPTSLResponse::GetResponseErrorList() const
+    void CppPTSLResponse::SetResponseBodyJson(const std::string& responseBodyJson)
+    {
+        mResponseBodyJson = MakeBuffer(std::string { responseBodyJson });
+    }
+
+    void CppPTSLResponse::SetResponseBodyJson(std::string&& responseBodyJson)
+    {
+        mResponseBodyJson = MakeBuffer(std::move(responseBodyJson));
+    }
+
+    std::string CppPTSLResponse::GetResponseErrorJson() const&
     {
-        return mResponseErrorList;
+        return mResponseErrorJson ? mResponseErrorJson->json : std::string {};
     }
 
-    static void ConvertProtoToCommandError(const ptsl::CommandError& in, CommandError& out)
+    std::string CppPTSLResponse::GetResponseErrorJson() &&
     {
-        out.errorType = static_cast<CommandErrorType>(in.command_error_type());
-        out.errorMessage = in.command_error_message();
-        out.isWarning = in.is_warning();
+        std::shared_ptr<ErrorData> taken = std::move(mResponseErrorJson);
+
+        if (!taken)
+        {
+            return {};
+        }
+
+        return taken.use_count() == 1 ? std::move(taken->json) : taken->json;
     }
 
-    void CppPTSLResponse::ParseResponseError()
+    std::string_view CppPTSLResponse::GetResponseErrorJsonView() const
     {
-        using namespace google::protobuf::util;
+        return mResponseErrorJson ? std::string_view { mResponseErrorJson->json } : std::string_view {};
+    }
 
-        JsonParseOptions jOpts = DefaultJsonParseOptions();
+    void CppPTSLResponse::SetResponseErrorJson(const std::string& responseErrorJson)
+    {
+        SetResponseErrorJson(std::string { responseErrorJson });
+    }
 
-        ptsl::ResponseError responseError;
+    void CppPTSLResponse::SetResponseErrorJson(std::string&& responseErrorJson)
+    {
+        // Parsed only when asked for: most responses of a stream are progress messages nobody inspects.
+        mResponseErrorJson = responseErrorJson.empty() ? nullptr : std::make_shared<ErrorData>(std::move(responseErrorJson));
+    }
 
-        auto status = JsonStringToMessage(mResponseErrorJson, &responseError, jOpts);
+    const std::vector<CommandError>& CppPTSLResponse::GetResponseErrors() const
+    {
+        static const std::vector<CommandError> noErrors;
 
-        if (!status.ok())
+        if (!mResponseErrorJson)
         {
-            ptsl::CommandError legacyError;
-            auto legacy_err_status = JsonStringToMessage(mResponseErrorJson, &legacyError);
-            if (legacy_err_status.ok())
-            {
-                responseError.add_errors()->CopyFrom(legacyError);
-            }
+            return noErrors;
         }
 
-        for (const auto& error : responseError.errors())
+        ErrorData& errorData = *mResponseErrorJson;
+        std::call_once(errorData.parseFlag, [&errorData]() { errorData.errors = ParseResponseErrors(errorData.json); });
+
+        return errorData.errors;
+    }
+
+    ResponseError CppPTSLResponse::GetResponseErrorList() const
+    {
+        ResponseError responseError;
+
+        for (const auto& error : GetResponseErrors())
         {
-            auto commandError = std::make_shared<CommandError>();
-            ConvertProtoToCommandError(error, *commandError);
-            mResponseErrorList.errors.push_back(commandError);
+            responseError.errors.push_back(std::make_shared<CommandError>(error));
         }
+
+        return responseError;
     }
 
     int32_t CppPTSLResponse::GetVersion() const
@@ -160,4 +268,14 @@ namespace PTSLC_CPP
         mVersionedResponseHeaderJson = versionedRequestHeaderJson;
     }
 
+    bool CppPTSLResponse::IsEventGap() const
+    {
+        return mIsEventGap;
+    }
+
+    void CppPTSLResponse::SetEventGap(bool isEventGap)
+    {
+        mIsEventGap = isEventGap;
+    }
+
 } // namespace PTSLC_CPP
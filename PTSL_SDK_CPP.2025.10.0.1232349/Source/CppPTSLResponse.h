@@ -10,11 +10,21 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "CppPTSLCommon.h"
+#include "CppPTSLJsonField.h"
 #include "PtslCCppExport.h"
 
 namespace PTSLC_CPP
 {
+    /**
+     * The response body and error JSON are kept in immutable buffers shared between the copies of a response,
+     * so copying a response (e.g. into the future returned by SendRequest) doesn't copy them.
+     */
     class PTSLC_CPP_EXPORT CppPTSLResponse
     {
     public:
@@ -34,12 +44,46 @@ namespace PTSLC_CPP
         int32_t GetProgress() const;
         void SetProgress(const int32_t progress);
 
-        std::string GetResponseBodyJson() const;
-        void SetResponseBodyJson(const std::string& responseBodyJson);
+        /**
+         * Returns a copy of the body. Called on a temporary, e.g. SendRequest(request).get().GetResponseBodyJson(),
+         * moves the body out instead if no other copy of the response shares it.
+         */
+        std::string GetResponseBodyJson() const&;
+        std::string GetResponseBodyJson() &&;
+
+        /**
+         * Returns the body without copying it. The view stays valid until the body of this response is replaced
+         * or the response is destroyed.
+         */
+        std::string_view GetResponseBodyJsonView() const;
+
+        /**
+         * Returns a single value of the body without parsing the rest of it,
+         * e.g. Field("pagination_response.total").AsInt(). See CppPTSLJsonField.
+         */
+        CppPTSLJsonField Field(std::string_view path) const;
 
-        std::string GetResponseErrorJson() const;
+        void SetResponseBodyJson(const std::string& responseBodyJson);
+        void SetResponseBodyJson(std::string&& responseBodyJson);
+
+        /**
+         * Same as the body accessors above, for the error JSON.
+         */
+        std::string GetResponseErrorJson() const&;
+        std::string GetResponseErrorJson() &&;
+        std::string_view GetResponseErrorJsonView() const;
         void SetResponseErrorJson(const std::string& responseErrorJson);
+        void SetResponseErrorJson(std::string&& responseErrorJson);
 
+        /**
+         * Errors parsed from the error JSON. The JSON is parsed on the first call and the result is cached
+         * (and shared with the copies of the response) until the error JSON is replaced.
+         */
+        const std::vector<CommandError>& GetResponseErrors() const;
+
+        /**
+         * Same errors as GetResponseErrors(), allocated anew on every call.
+         */
         ResponseError GetResponseErrorList() const;
 
         int32_t GetVersion() const;
@@ -54,8 +98,16 @@ namespace PTSLC_CPP
         std::string GetVersionedResponseHeaderJson() const;
         void SetVersionedResponseHeaderJson(const std::string& versionedRequestHeaderJson);
 
+        /**
+         * True for the marker delivered to the PollEvents response callback when the event stream was restored
+         * after a reconnect (see ClientConfig::autoReconnect); events that happened in between were missed.
+         * The marker has no response body.
+         */
+        bool IsEventGap() const;
+        void SetEventGap(bool isEventGap);
+
     private:
-        void ParseResponseError();
+        struct ErrorData;
 
         // data of response header
         std::string mTaskId = "";
@@ -66,12 +118,10 @@ namespace PTSLC_CPP
         int32_t mVersionMinor = 0;
         int32_t mVersionRevision = 0;
         std::string mVersionedResponseHeaderJson = "";
+        bool mIsEventGap = false;
 
-        // data of response body
-        std::string mResponseBodyJson = "";
-        std::string mResponseErrorJson = "";
-
-        // parsed data of response error
-        ResponseError mResponseErrorList;
+        // data of response body; null when empty
+        std::shared_ptr<std::string> mResponseBodyJson;
+        std::shared_ptr<ErrorData> mResponseErrorJson;
     };
 } // namespace PTSLC_CPP
@@ -0,0 +1,299 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLResponseCache.h
+ */
+
+#include "CppPTSLResponseCache.h"
+
+#include <vector>
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        const std::vector<CommandId> TRACK_QUERIES { CommandId::CId_GetTrackList,
+            CommandId::CId_GetTrackControlInfo,
+            CommandId::CId_GetTrackControlValue,
+            CommandId::CId_GetTrackPlaylists,
+            CommandId::CId_GetPlaylistElements,
+            CommandId::CId_GetExportMixSourceList };
+
+        const std::vector<CommandId> TRACK_STATE_QUERIES { CommandId::CId_GetTrackList };
+
+        const std::vector<CommandId> MEMORY_LOCATION_QUERIES { CommandId::CId_GetMemoryLocations };
+
+        const std::vector<CommandId> SELECTION_QUERIES { CommandId::CId_GetTimelineSelection,
+            CommandId::CId_GetEditSelection };
+
+        const std::vector<CommandId> TRANSPORT_QUERIES { CommandId::CId_GetTransportState,
+            CommandId::CId_GetTransportArmed };
+
+        /**
+         * Returns the queries whose responses the command may change, or null if that's unknown.
+         */
+        const std::vector<CommandId>* FindChangedQueries(CommandId commandId)
+        {
+            static const std::unordered_map<CommandId, std::vector<CommandId>> changedQueries {
+                // Session properties
+                { CommandId::CId_SetSessionAudioFormat, { CommandId::CId_GetSessionAudioFormat } },
+                { CommandId::CId_SetSessionBitDepth, { CommandId::CId_GetSessionBitDepth } },
+                { CommandId::CId_SetSessionInterleavedState, { CommandId::CId_GetSessionInterleavedState } },
+                { CommandId::CId_SetSessionTimeCodeRate, { CommandId::CId_GetSessionTimeCodeRate } },
+                { CommandId::CId_SetSessionFeetFramesRate, { CommandId::CId_GetSessionFeetFramesRate } },
+                { CommandId::CId_SetSessionAudioRatePullSettings, { CommandId::CId_GetSessionAudioRatePullSettings } },
+                { CommandId::CId_SetSessionVideoRatePullSettings, { CommandId::CId_GetSessionVideoRatePullSettings } },
+                { CommandId::CId_SetSessionLength, { CommandId::CId_GetSessionLength } },
+                { CommandId::CId_SetSessionStartTime, { CommandId::CId_GetSessionStartTime } },
+
+                // Modes and settings of the application
+                { CommandId::CId_SetPlaybackMode, { CommandId::CId_GetPlaybackMode } },
+                { CommandId::CId_SetRecordMode, { CommandId::CId_GetRecordMode } },
+                { CommandId::CId_SetEditMode, { CommandId::CId_GetEditMode } },
+                { CommandId::CId_SetEditModeOptions, { CommandId::CId_GetEditModeOptions } },
+                { CommandId::CId_SetEditTool, { CommandId::CId_GetEditTool } },
+                { CommandId::CId_SetMainCounterFormat, { CommandId::CId_GetMainCounterFormat } },
+                { CommandId::CId_SetSubCounterFormat, { CommandId::CId_GetSubCounterFormat } },
+                { CommandId::CId_SetMemoryLocationsManageMode, { CommandId::CId_GetMemoryLocationsManageMode } },
+
+                // Tracks
+                { CommandId::CId_CreateNewTracks, TRACK_QUERIES },
+                { CommandId::CId_DeleteTracks, TRACK_QUERIES },
+                { CommandId::CId_RenameTargetTrack, TRACK_QUERIES },
+                { CommandId::CId_SetTrackControlValue, { CommandId::CId_GetTrackControlValue } },
+                { CommandId::CId_SetTrackColor, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackDSPModeSafeState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackFrozenState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackHiddenState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackInactiveState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackInputMonitorState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackMainOutputAssignments, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackMuteState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackOnlineState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackOpenState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackRecordEnableState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackRecordSafeEnableState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackSmartDspState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackSoloSafeState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackSoloState, TRACK_STATE_QUERIES },
+                { CommandId::CId_SetTrackTimebase, TRACK_STATE_QUERIES },
+                { CommandId::CId_SelectTracksByName, TRACK_STATE_QUERIES },
+
+                // Memory locations and selection
+                { CommandId::CId_CreateMemoryLocation, MEMORY_LOCATION_QUERIES },
+                { CommandId::CId_EditMemoryLocation, MEMORY_LOCATION_QUERIES },
+                { CommandId::CId_ClearMemoryLocation, MEMORY_LOCATION_QUERIES },
+                { CommandId::CId_ClearAllMemoryLocations, MEMORY_LOCATION_QUERIES },
+                { CommandId::CId_SelectMemoryLocation, SELECTION_QUERIES },
+                { CommandId::CId_SetTimelineSelection, SELECTION_QUERIES },
+
+                // Transport
+                { CommandId::CId_TogglePlayState, TRANSPORT_QUERIES },
+                { CommandId::CId_ToggleRecordEnable, TRANSPORT_QUERIES },
+                { CommandId::CId_PlayHalfSpeed, TRANSPORT_QUERIES },
+                { CommandId::CId_RecordHalfSpeed, TRANSPORT_QUERIES },
+                { CommandId::CId_BeginScrub, TRANSPORT_QUERIES },
+                { CommandId::CId_ContinueScrub, TRANSPORT_QUERIES },
+                { CommandId::CId_EndScrub, TRANSPORT_QUERIES },
+
+                // Commands that don't change what can be queried
+                { CommandId::CId_RegisterConnection, {} },
+                { CommandId::CId_EnableAPI, {} },
+                { CommandId::CId_ExchangePublicKeys, {} },
+                { CommandId::CId_SubscribeToEvents, {} },
+                { CommandId::CId_UnsubscribeFromEvents, {} },
+                { CommandId::CId_PollEvents, {} },
+                { CommandId::CId_CreateBatchJob, {} },
+                { CommandId::CId_CompleteBatchJob, {} },
+                { CommandId::CId_CancelBatchJob, {} },
+                { CommandId::CId_InstallMenuHandler, {} },
+                { CommandId::CId_UninstallMenuHandler, {} },
+                { CommandId::CId_SaveSession, {} },
+            };
+
+            auto it = changedQueries.find(commandId);
+            return it != changedQueries.end() ? &it->second : nullptr;
+        }
+    } // namespace
+
+    ResponseCache::ResponseCache(const std::map<CommandId, std::chrono::milliseconds>& timeToLive, size_t maxEntries)
+        : m_maxEntries(maxEntries)
+    {
+        for (const auto& [commandId, commandTimeToLive] : timeToLive)
+        {
+            if (commandTimeToLive.count() > 0)
+            {
+                m_commands[commandId].m_timeToLive = commandTimeToLive;
+            }
+        }
+    }
+
+    std::optional<CppPTSLResponse> ResponseCache::Find(const RequestKey& key)
+    {
+        auto commandIt = m_commands.find(key.m_commandId);
+
+        if (commandIt == m_commands.end())
+        {
+            return std::nullopt;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto& entries = commandIt->second.m_entries;
+        auto it = entries.find(key);
+
+        if (it == entries.end())
+        {
+            ++m_misses;
+            return std::nullopt;
+        }
+
+        if (it->second.m_expiresAt <= std::chrono::steady_clock::now())
+        {
+            entries.erase(it);
+            --m_entryCount;
+            ++m_misses;
+            return std::nullopt;
+        }
+
+        ++m_hits;
+        return it->second.m_response;
+    }
+
+    ResponseCache::Ticket ResponseCache::TakeTicket(CommandId commandId) const
+    {
+        auto commandIt = m_commands.find(commandId);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return Ticket { m_epoch, commandIt != m_commands.end() ? commandIt->second.m_generation : 0 };
+    }
+
+    void ResponseCache::Store(const RequestKey& key, const CppPTSLResponse& response, const Ticket& ticket)
+    {
+        auto commandIt = m_commands.find(key.m_commandId);
+
+        if (commandIt == m_commands.end())
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        CommandEntries& commandEntries = commandIt->second;
+
+        if (ticket.m_epoch != m_epoch || ticket.m_generation != commandEntries.m_generation)
+        {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if (m_entryCount >= m_maxEntries && commandEntries.m_entries.count(key) == 0)
+        {
+            MakeRoom(now);
+        }
+
+        auto inserted = commandEntries.m_entries.insert_or_assign(key, Entry { response, now + commandEntries.m_timeToLive });
+
+        if (inserted.second)
+        {
+            ++m_entryCount;
+        }
+    }
+
+    void ResponseCache::OnCommandFinished(CommandId commandId)
+    {
+        const std::vector<CommandId>* changedQueries = FindChangedQueries(commandId);
+
+        if (!changedQueries)
+        {
+            Clear();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (CommandId query : *changedQueries)
+        {
+            auto commandIt = m_commands.find(query);
+
+            if (commandIt != m_commands.end())
+            {
+                Evict(commandIt->second);
+            }
+        }
+    }
+
+    void ResponseCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        ++m_epoch;
+
+        for (auto& command : m_commands)
+        {
+            Evict(command.second);
+        }
+    }
+
+    ResponseCacheMetrics ResponseCache::GetMetrics() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        ResponseCacheMetrics metrics;
+        metrics.hits = m_hits;
+        metrics.misses = m_misses;
+        metrics.evictions = m_evictions;
+        metrics.entries = m_entryCount;
+        return metrics;
+    }
+
+    void ResponseCache::Evict(CommandEntries& commandEntries)
+    {
+        ++commandEntries.m_generation;
+        m_evictions += commandEntries.m_entries.size();
+        m_entryCount -= commandEntries.m_entries.size();
+        commandEntries.m_entries.clear();
+    }
+
+    void ResponseCache::MakeRoom(std::chrono::steady_clock::time_point now)
+    {
+        using EntryMap = std::unordered_map<RequestKey, Entry, RequestKeyHash>;
+
+        EntryMap* soonestEntries = nullptr;
+        EntryMap::iterator soonest;
+
+        for (auto& command : m_commands)
+        {
+            auto& entries = command.second.m_entries;
+
+            for (auto it = entries.begin(); it != entries.end();)
+            {
+                if (it->second.m_expiresAt <= now)
+                {
+                    it = entries.erase(it);
+                    --m_entryCount;
+                    continue;
+                }
+
+                if (!soonestEntries || it->second.m_expiresAt < soonest->second.m_expiresAt)
+                {
+                    soonestEntries = &entries;
+                    soonest = it;
+                }
+
+                ++it;
+            }
+        }
+
+        // Nothing has expired: the response that would expire first gives way.
+        if (m_entryCount >= m_maxEntries && soonestEntries)
+        {
+            soonestEntries->erase(soonest);
+            --m_entryCount;
+        }
+    }
+} // namespace PTSLC_CPP
@@ -0,0 +1,153 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Cache of the responses to read-only commands of the PTSL client.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "CppPTSLCommon.h"
+#include "CppPTSLResponse.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Identifies requests that get the same response: same command, session, version and body.
+     */
+    struct RequestKey
+    {
+        CommandId m_commandId;
+        std::string m_sessionId;
+        int32_t m_version;
+        int32_t m_versionMinor;
+        int32_t m_versionRevision;
+        std::string m_versionedRequestHeaderJson;
+        std::string m_requestBodyJson;
+
+        bool operator==(const RequestKey& other) const
+        {
+            return m_commandId == other.m_commandId && m_version == other.m_version
+                && m_versionMinor == other.m_versionMinor && m_versionRevision == other.m_versionRevision
+                && m_sessionId == other.m_sessionId && m_requestBodyJson == other.m_requestBodyJson
+                && m_versionedRequestHeaderJson == other.m_versionedRequestHeaderJson;
+        }
+    };
+
+    struct RequestKeyHash
+    {
+        size_t operator()(const RequestKey& key) const
+        {
+            size_t hash = std::hash<std::string> {}(key.m_requestBodyJson);
+
+            auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+
+            combine(static_cast<size_t>(key.m_commandId));
+            combine(std::hash<std::string> {}(key.m_sessionId));
+            combine(static_cast<size_t>(key.m_version) ^ (static_cast<size_t>(key.m_versionMinor) << 16)
+                ^ (static_cast<size_t>(key.m_versionRevision) << 32));
+            combine(std::hash<std::string> {}(key.m_versionedRequestHeaderJson));
+            return hash;
+        }
+    };
+
+    /**
+     * Responses to read-only commands, kept for a time to live per command.
+     *
+     * Commands that change the state of Pro Tools evict the responses they may have made stale once they finish,
+     * commands the cache knows nothing about evict all of them. A response is only stored if nothing evicted its
+     * command while the request was in flight, so a read racing with a change can't bring back the old state.
+     */
+    class ResponseCache
+    {
+    public:
+        /**
+         * Taken when a request is sent, see Store.
+         */
+        struct Ticket
+        {
+            uint64_t m_epoch = 0;
+            uint64_t m_generation = 0;
+        };
+
+        /**
+         * @param timeToLive Cached commands, which must be read-only, and their time to live.
+         * @param maxEntries Upper limit of the stored responses.
+         */
+        ResponseCache(const std::map<CommandId, std::chrono::milliseconds>& timeToLive, size_t maxEntries);
+
+        ResponseCache(const ResponseCache&) = delete;
+        ResponseCache& operator=(const ResponseCache&) = delete;
+
+        bool IsCached(CommandId commandId) const
+        {
+            return m_commands.count(commandId) != 0;
+        }
+
+        /**
+         * Returns the stored response to the request, if it hasn't expired yet. Counts a hit or a miss.
+         */
+        std::optional<CppPTSLResponse> Find(const RequestKey& key);
+
+        Ticket TakeTicket(CommandId commandId) const;
+
+        /**
+         * Stores a successful response, unless the command was evicted after the ticket was taken.
+         * A full cache drops its expired responses, or else the one that expires first.
+         */
+        void Store(const RequestKey& key, const CppPTSLResponse& response, const Ticket& ticket);
+
+        /**
+         * Evicts what a finished command may have changed.
+         */
+        void OnCommandFinished(CommandId commandId);
+
+        void Clear();
+
+        ResponseCacheMetrics GetMetrics() const;
+
+    private:
+        struct Entry
+        {
+            CppPTSLResponse m_response;
+            std::chrono::steady_clock::time_point m_expiresAt;
+        };
+
+        struct CommandEntries
+        {
+            std::chrono::milliseconds m_timeToLive;
+            uint64_t m_generation = 0;
+            std::unordered_map<RequestKey, Entry, RequestKeyHash> m_entries;
+        };
+
+        /// Requires m_mutex.
+        void Evict(CommandEntries& commandEntries);
+
+        /// Removes the expired responses, or the one that expires first if none has. Requires m_mutex.
+        void MakeRoom(std::chrono::steady_clock::time_point now);
+
+        const size_t m_maxEntries;
+
+        mutable std::mutex m_mutex;
+
+        /// The set of commands is fixed at construction, so it can be looked up without the lock.
+        std::unordered_map<CommandId, CommandEntries> m_commands;
+        uint64_t m_epoch = 0;
+        size_t m_entryCount = 0;
+
+        uint64_t m_hits = 0;
+        uint64_t m_misses = 0;
+        uint64_t m_evictions = 0;
+    };
+} // namespace PTSLC_CPP
@@ -0,0 +1,63 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLRetry.h
+ */
+
+#include "CppPTSLRetry.h"
+
+#include <algorithm>
+#include <random>
+
+namespace PTSLC_CPP
+{
+    RetryBudget::RetryBudget(int32_t maxTokens, double tokenRatio)
+        : m_maxTokens(std::max<int64_t>(maxTokens, 0) * TOKEN_SCALE),
+          m_tokenRatio(static_cast<int64_t>(std::max(tokenRatio, 0.0) * TOKEN_SCALE)),
+          m_tokens(m_maxTokens)
+    {
+    }
+
+    bool RetryBudget::OnFailure()
+    {
+        int64_t tokens = m_tokens.load(std::memory_order_relaxed);
+        int64_t newTokens = 0;
+
+        do
+        {
+            newTokens = std::max<int64_t>(tokens - TOKEN_SCALE, 0);
+        } while (!m_tokens.compare_exchange_weak(tokens, newTokens, std::memory_order_relaxed));
+
+        return newTokens > m_maxTokens / 2;
+    }
+
+    void RetryBudget::OnSuccess()
+    {
+        int64_t tokens = m_tokens.load(std::memory_order_relaxed);
+
+        while (tokens < m_maxTokens
+            && !m_tokens.compare_exchange_weak(
+                tokens, std::min(tokens + m_tokenRatio, m_maxTokens), std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::chrono::milliseconds ComputeRetryBackoff(const RetryPolicy& retryPolicy, int32_t retry)
+    {
+        thread_local std::mt19937 randomEngine { std::random_device {}() };
+
+        const int64_t maxBackoff = std::max<int64_t>(retryPolicy.maxBackoff.count(), 0);
+        int64_t backoff = std::clamp<int64_t>(retryPolicy.initialBackoff.count(), 0, maxBackoff);
+
+        for (int32_t i = 1; i < retry && backoff < maxBackoff; ++i)
+        {
+            backoff = std::min(backoff * 2, maxBackoff);
+        }
+
+        // Randomize within [backoff / 2, backoff] so clients failing at the same time don't retry at the same time.
+        std::uniform_int_distribution<int64_t> jitter { backoff / 2, backoff };
+        return std::chrono::milliseconds { jitter(randomEngine) };
+    }
+} // namespace PTSLC_CPP
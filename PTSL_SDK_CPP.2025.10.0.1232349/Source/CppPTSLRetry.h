@@ -0,0 +1,55 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Retry helpers of the PTSL client: retry budget and backoff calculation.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "CppPTSLCommon.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Token bucket that throttles retries of all requests of a client.
+     *
+     * Every failed attempt takes a token, every successful request returns tokenRatio tokens.
+     * Retries are allowed only while more than half of the tokens are left,
+     * so a host that fails every request quickly stops receiving retries.
+     */
+    class RetryBudget
+    {
+    public:
+        RetryBudget(int32_t maxTokens, double tokenRatio);
+
+        /**
+         * Records a failed attempt and returns true if it may be retried.
+         */
+        bool OnFailure();
+
+        /**
+         * Records a successful request.
+         */
+        void OnSuccess();
+
+    private:
+        /// Tokens are stored in thousandths to keep the counter integral.
+        static constexpr int64_t TOKEN_SCALE = 1000;
+
+        const int64_t m_maxTokens;
+        const int64_t m_tokenRatio;
+        std::atomic<int64_t> m_tokens;
+    };
+
+    /**
+     * Returns the delay before the given retry (1 for the first retry) with the random jitter applied.
+     */
+    std::chrono::milliseconds ComputeRetryBackoff(const RetryPolicy& retryPolicy, int32_t retry);
+} // namespace PTSLC_CPP
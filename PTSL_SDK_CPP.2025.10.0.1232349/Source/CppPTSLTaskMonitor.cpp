@@ -0,0 +1,277 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Implementation file for the CppPTSLTaskMonitor.h
+ */
+
+#include "CppPTSLTaskMonitor.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "CppAsync.h"
+
+namespace PTSLC_CPP
+{
+    namespace
+    {
+        bool IsFinalStatus(TaskStatus status)
+        {
+            return status == TaskStatus::TStatus_Completed || status == TaskStatus::TStatus_Failed
+                || status == TaskStatus::TStatus_CompletedWithBadResponse
+                || status == TaskStatus::TStatus_FailedWithBadErrorResponse;
+        }
+
+        void Notify(const std::vector<TaskMonitor::StatusHandler>& handlers, const TaskStatusUpdate& update)
+        {
+            for (const auto& handler : handlers)
+            {
+                try
+                {
+                    handler(update);
+                }
+                catch (const std::exception& e)
+                {
+                    // There is nobody to rethrow to on the service thread.
+                    SafeLogger::SyncPrint(std::string { "Exception in the task status callback: " } + e.what() + "\n");
+                }
+                catch (...)
+                {
+                    SafeLogger::SyncPrint("Unknown exception in the task status callback.\n");
+                }
+            }
+        }
+    } // namespace
+
+    TaskMonitor::TaskMonitor(AsyncEngine& asyncEngine,
+        PollFunction poll,
+        std::chrono::milliseconds initialInterval,
+        std::chrono::milliseconds maxInterval)
+        : m_asyncEngine(asyncEngine),
+          m_poll(std::move(poll)),
+          m_initialInterval(std::max(initialInterval, std::chrono::milliseconds { 1 })),
+          m_maxInterval(std::max(maxInterval, std::max(initialInterval, std::chrono::milliseconds { 1 })))
+    {
+    }
+
+    TaskMonitor::~TaskMonitor()
+    {
+        Stop();
+    }
+
+    uint64_t TaskMonitor::Watch(const std::string& taskId, StatusHandler onStatusChanged)
+    {
+        std::optional<TaskStatusUpdate> lastUpdate;
+        uint64_t watchId = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_isStopped)
+            {
+                return 0;
+            }
+
+            auto inserted = m_tasks.try_emplace(taskId);
+            Task& task = inserted.first->second;
+
+            if (inserted.second)
+            {
+                task.m_interval = m_initialInterval;
+                task.m_nextPollAt = std::chrono::steady_clock::now() + m_initialInterval;
+            }
+
+            watchId = m_nextWatchId++;
+            task.m_watchers.emplace(watchId, onStatusChanged);
+            m_watchedTasks.emplace(watchId, taskId);
+            lastUpdate = task.m_lastUpdate;
+
+            ScheduleTimer();
+        }
+
+        if (lastUpdate)
+        {
+            Notify({ std::move(onStatusChanged) }, *lastUpdate);
+        }
+
+        return watchId;
+    }
+
+    void TaskMonitor::Unwatch(uint64_t watchId)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto watchIt = m_watchedTasks.find(watchId);
+
+        if (watchIt == m_watchedTasks.end())
+        {
+            return;
+        }
+
+        auto taskIt = m_tasks.find(watchIt->second);
+        m_watchedTasks.erase(watchIt);
+
+        if (taskIt != m_tasks.end())
+        {
+            taskIt->second.m_watchers.erase(watchId);
+
+            // A poll in flight finds no task and is dropped.
+            if (taskIt->second.m_watchers.empty())
+            {
+                m_tasks.erase(taskIt);
+            }
+        }
+    }
+
+    void TaskMonitor::Stop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        m_isStopped = true;
+        m_tasks.clear();
+        m_watchedTasks.clear();
+
+        if (m_timer)
+        {
+            m_timer->Cancel();
+        }
+
+        m_idle.wait(lock, [this]() { return !m_timer && m_pollsInFlight == 0; });
+    }
+
+    void TaskMonitor::ScheduleTimer()
+    {
+        if (m_isStopped)
+        {
+            return;
+        }
+
+        std::optional<std::chrono::steady_clock::time_point> nextPollAt;
+
+        for (const auto& task : m_tasks)
+        {
+            if (!task.second.m_isPolling && (!nextPollAt || task.second.m_nextPollAt < *nextPollAt))
+            {
+                nextPollAt = task.second.m_nextPollAt;
+            }
+        }
+
+        if (!nextPollAt)
+        {
+            return;
+        }
+
+        if (m_timer)
+        {
+            // The handler schedules the timer again for the earlier poll.
+            if (*nextPollAt < m_timerDeadline)
+            {
+                m_timer->Cancel();
+            }
+
+            return;
+        }
+
+        m_timer = new AsyncAlarm([this](bool) { OnTimer(); });
+        m_timerDeadline = *nextPollAt;
+        m_timer->Set(m_asyncEngine.NextCompletionQueue(),
+            std::chrono::system_clock::now() + (*nextPollAt - std::chrono::steady_clock::now()));
+    }
+
+    void TaskMonitor::OnTimer()
+    {
+        std::vector<std::string> dueTasks;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_timer = nullptr;
+
+            if (m_isStopped)
+            {
+                m_idle.notify_all();
+                return;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+
+            for (auto& task : m_tasks)
+            {
+                if (!task.second.m_isPolling && task.second.m_nextPollAt <= now)
+                {
+                    task.second.m_isPolling = true;
+                    dueTasks.push_back(task.first);
+                }
+            }
+
+            m_pollsInFlight += static_cast<int32_t>(dueTasks.size());
+
+            ScheduleTimer();
+        }
+
+        for (const auto& taskId : dueTasks)
+        {
+            m_poll(taskId, [this, taskId](std::optional<TaskStatusUpdate> update) { OnPolled(taskId, std::move(update)); });
+        }
+    }
+
+    void TaskMonitor::OnPolled(const std::string& taskId, std::optional<TaskStatusUpdate> update)
+    {
+        std::vector<StatusHandler> handlers;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            --m_pollsInFlight;
+
+            auto taskIt = m_tasks.find(taskId);
+
+            if (m_isStopped || taskIt == m_tasks.end())
+            {
+                m_idle.notify_all();
+                return;
+            }
+
+            Task& task = taskIt->second;
+            task.m_isPolling = false;
+
+            const bool isChanged = update
+                && (!task.m_lastUpdate || task.m_lastUpdate->status != update->status
+                    || task.m_lastUpdate->progress != update->progress);
+
+            if (isChanged)
+            {
+                for (const auto& watcher : task.m_watchers)
+                {
+                    handlers.push_back(watcher.second);
+                }
+
+                task.m_lastUpdate = update;
+            }
+
+            if (update && IsFinalStatus(update->status))
+            {
+                for (const auto& watcher : task.m_watchers)
+                {
+                    m_watchedTasks.erase(watcher.first);
+                }
+
+                m_tasks.erase(taskIt);
+            }
+            else
+            {
+                task.m_interval = isChanged ? m_initialInterval : std::min(task.m_interval * 2, m_maxInterval);
+                task.m_nextPollAt = std::chrono::steady_clock::now() + task.m_interval;
+            }
+
+            ScheduleTimer();
+        }
+
+        if (!handlers.empty())
+        {
+            Notify(handlers, *update);
+        }
+    }
+} // namespace PTSLC_CPP
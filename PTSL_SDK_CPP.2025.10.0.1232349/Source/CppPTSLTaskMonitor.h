@@ -0,0 +1,112 @@
+// Copyright 2025 by Avid Technology, Inc.
+// CONFIDENTIAL: this document contains confidential information of Avid. Do not disclose to any third party. Use of the information contained in this document is subject to an Avid SDK license.
+
+/**
+ * @file
+ * @brief Shared monitor of the status of the tasks running in Pro Tools.
+ *
+ * Should only be included in .cpp files.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "CppPTSLAsyncEngine.h"
+#include "CppPTSLCommon.h"
+
+namespace PTSLC_CPP
+{
+    /**
+     * Polls the status of all watched tasks from a single timer on the async engine.
+     *
+     * Each task is polled once per interval, however many watchers it has. The interval starts short and doubles
+     * up to the maximum while the status doesn't change; a change resets it. The watchers are notified of every
+     * change, the last time with a final status, after which the task is no longer watched.
+     */
+    class TaskMonitor
+    {
+    public:
+        using StatusHandler = std::function<void(const TaskStatusUpdate&)>;
+
+        /**
+         * Receives the polled status of a task, or nothing if the poll failed and has to be repeated.
+         */
+        using PollResultHandler = std::function<void(std::optional<TaskStatusUpdate>)>;
+
+        /**
+         * Requests the status of a task, e.g. with GetTaskStatus, and passes it to the handler.
+         */
+        using PollFunction = std::function<void(const std::string& taskId, PollResultHandler onPolled)>;
+
+        TaskMonitor(AsyncEngine& asyncEngine,
+            PollFunction poll,
+            std::chrono::milliseconds initialInterval,
+            std::chrono::milliseconds maxInterval);
+
+        ~TaskMonitor();
+
+        TaskMonitor(const TaskMonitor&) = delete;
+        TaskMonitor& operator=(const TaskMonitor&) = delete;
+
+        /**
+         * Starts watching the task. A task that has been polled before reports its last status right away.
+         * onStatusChanged is called without the internal lock held, usually on a poller thread.
+         *
+         * @returns Id for Unwatch, or 0 if the monitor is stopped.
+         */
+        uint64_t Watch(const std::string& taskId, StatusHandler onStatusChanged);
+
+        /**
+         * Stops the notifications of the watcher. The handler may still be running on another thread.
+         */
+        void Unwatch(uint64_t watchId);
+
+        /**
+         * Drops all watchers and waits until the timer and the polls in flight are finished.
+         * The polls must be able to finish, e.g. because the client cancels its requests.
+         */
+        void Stop();
+
+    private:
+        struct Task
+        {
+            std::map<uint64_t, StatusHandler> m_watchers;
+            std::chrono::steady_clock::duration m_interval;
+            std::chrono::steady_clock::time_point m_nextPollAt;
+            std::optional<TaskStatusUpdate> m_lastUpdate;
+            bool m_isPolling = false;
+        };
+
+        /// Requires m_mutex.
+        void ScheduleTimer();
+
+        void OnTimer();
+        void OnPolled(const std::string& taskId, std::optional<TaskStatusUpdate> update);
+
+        AsyncEngine& m_asyncEngine;
+        const PollFunction m_poll;
+        const std::chrono::steady_clock::duration m_initialInterval;
+        const std::chrono::steady_clock::duration m_maxInterval;
+
+        std::mutex m_mutex;
+        std::condition_variable m_idle;
+
+        std::unordered_map<std::string, Task> m_tasks;
+        std::unordered_map<uint64_t, std::string> m_watchedTasks;
+        uint64_t m_nextWatchId = 1;
+
+        /// The pending alarm, if any; reset by its handler before anything else.
+        AsyncAlarm* m_timer = nullptr;
+        std::chrono::steady_clock::time_point m_timerDeadline;
+        int32_t m_pollsInFlight = 0;
+        bool m_isStopped = false;
+    };
+} // namespace PTSLC_CPP